@@ -0,0 +1,132 @@
+#include <benchmark/benchmark.h>
+#include <stdexec/execution.hpp>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include "signal_arena.hpp"
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+using namespace daking;
+using namespace stdexec;
+
+struct ArenaSignal : signal<int> { using base::base; };
+
+struct ArenaEngine : enable_signal<ArenaSignal> {
+    ArenaEngine() = default;
+    explicit ArenaEngine(std::pmr::memory_resource* resource) : enable_signal<ArenaSignal>(resource) {}
+};
+
+// dTLB load misses of the calling thread, through perf_event_open; invalid where perf is not permitted.
+class dtlb_counter {
+public:
+    dtlb_counter() {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size           = sizeof(attr);
+        attr.type           = PERF_TYPE_HW_CACHE;
+        attr.config         = PERF_COUNT_HW_CACHE_DTLB
+                            | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                            | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attr.disabled       = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        fd_ = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+
+    ~dtlb_counter() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+
+    bool valid() const noexcept { return fd_ >= 0; }
+
+    void start() {
+        ::ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+        ::ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+    }
+
+    std::uint64_t stop() {
+        ::ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+        std::uint64_t count = 0;
+        return ::read(fd_, &count, sizeof(count)) == sizeof(count) ? count : 0;
+    }
+
+private:
+    int fd_;
+};
+
+// N slots, all but one disabled, so a broadcast is a walk over N slot objects reading their flags.
+// Under the default allocator the slots are interleaved with other heap traffic, as in a process
+// that connects over time; the arena packs them onto a few huge pages.
+template <bool UseArena>
+static void BM_Arena_Broadcast_Walk(benchmark::State& state) {
+    std::unique_ptr<huge_page_arena> arena;
+    std::unique_ptr<ArenaEngine>     engine;
+    if constexpr (UseArena) {
+        arena  = std::make_unique<huge_page_arena>(detail::current_node());
+        engine = std::make_unique<ArenaEngine>(arena.get());
+    }
+    else {
+        engine = std::make_unique<ArenaEngine>();
+    }
+
+    std::vector<std::unique_ptr<char[]>> noise;
+    for (int i = 0; i < state.range(0); ++i) {
+        auto con = daking::connect<ArenaSignal>(*engine, then([](int) {}));
+        if (i != 0) {
+            con.disable();
+        }
+        noise.push_back(std::make_unique<char[]>(4096));
+    }
+
+    dtlb_counter misses;
+    if (misses.valid()) {
+        misses.start();
+    }
+    for (auto _ : state) {
+        emit(ArenaSignal{42}, daking::broadcast, *engine);
+    }
+    if (misses.valid()) {
+        state.counters["dTLB-misses/iter"] = benchmark::Counter(
+            static_cast<double>(misses.stop()) / static_cast<double>(state.iterations()));
+    }
+    if constexpr (UseArena) {
+        state.counters["huge_bytes"] = static_cast<double>(arena->huge_bytes());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Arena_Broadcast_Walk, false)->Arg(1000)->Arg(10000)->Arg(50000);
+BENCHMARK_TEMPLATE(BM_Arena_Broadcast_Walk, true)->Arg(1000)->Arg(10000)->Arg(50000);
+
+// Connect and disconnect churn: slot and snapshot allocations from the pooled arena or the heap.
+template <bool UseArena>
+static void BM_Arena_Connect_Disconnect(benchmark::State& state) {
+    std::unique_ptr<huge_page_arena> arena;
+    std::unique_ptr<ArenaEngine>     engine;
+    if constexpr (UseArena) {
+        arena  = std::make_unique<huge_page_arena>();
+        engine = std::make_unique<ArenaEngine>(arena.get());
+    }
+    else {
+        engine = std::make_unique<ArenaEngine>();
+    }
+    for (int i = 0; i < state.range(0); ++i) {
+        daking::connect<ArenaSignal>(*engine, then([](int) {}));
+    }
+
+    for (auto _ : state) {
+        auto con = daking::connect<ArenaSignal>(*engine, then([](int) {}));
+        daking::disconnect<ArenaSignal>(*engine, con);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_Arena_Connect_Disconnect, false)->Arg(0)->Arg(100);
+BENCHMARK_TEMPLATE(BM_Arena_Connect_Disconnect, true)->Arg(0)->Arg(100);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,39 @@
+#include <benchmark/benchmark.h>
+#include <stdexec/execution.hpp>
+#include <atomic>
+#include <thread>
+#include "signal_bridge.hpp"
+
+using namespace daking;
+using namespace stdexec;
+
+struct Telemetry : signal<std::uint64_t, double, double> { using base::base; };
+struct Feed : enable_signal<Telemetry> {};
+
+// Emissions per timed iteration; each iteration ends once the receiving emitter has broadcast all of them.
+static constexpr int BATCH = 4096;
+
+// One process, two emitters joined by a socketpair: encode, stage, gather-write, recvmmsg, decode, re-emit.
+static void BM_Bridge_Throughput(benchmark::State& state) {
+    const std::size_t WINDOW = state.range(0);
+    auto [near, far] = seqpacket_socket::pair();
+    Feed local, remote;
+
+    std::atomic<std::uint64_t> seen = 0;
+    daking::connect<Telemetry>(remote, then([&](std::uint64_t, double, double) { seen.fetch_add(1, std::memory_order_release); }));
+    bridge_receiver<Telemetry> receiver(remote, std::move(far), WINDOW);
+    bridge_sender<Telemetry> sender(local, std::move(near));
+
+    std::uint64_t emitted = 0;
+    for (auto _ : state) {
+        for (int i = 0; i < BATCH; i++) {
+            daking::emit(Telemetry{emitted++, 1.0, 2.0}, broadcast, local);
+        }
+        while (seen.load(std::memory_order_acquire) != emitted) {
+            std::this_thread::yield();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * BATCH);
+    state.counters["frames/packet"] = static_cast<double>(sender.sent()) / std::max<std::uint64_t>(sender.packets(), 1);
+}
+BENCHMARK(BM_Bridge_Throughput)->Arg(16)->Arg(256)->Arg(4096)->UseRealTime();
@@ -0,0 +1,132 @@
+#include <benchmark/benchmark.h>
+#include <stdexec/execution.hpp>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "signal_codec.hpp"
+
+using namespace daking;
+
+// A telemetry sample: timestamp, device id, four readings and a free-form tag.
+struct Sample : signal<std::uint64_t, std::uint32_t, std::vector<double>, std::string> { using base::base; };
+
+static Sample Make_sample() {
+    return Sample{std::uint64_t(1'700'000'000'000'000'000ull), std::uint32_t(4217),
+        std::vector<double>{21.5, 0.98, 1013.25, 3.3}, std::string("line3.press.hydraulics")};
+}
+
+// Hand-written protobuf wire format for the same message (fields 1..4: varint, varint, packed fixed64, bytes),
+// the way a generated encoder would lay it out without the runtime library.
+namespace proto {
+    static std::byte* Varint(std::byte* out, std::uint64_t value) {
+        while (value >= 0x80) {
+            *out++ = static_cast<std::byte>(value | 0x80);
+            value >>= 7;
+        }
+        *out++ = static_cast<std::byte>(value);
+        return out;
+    }
+
+    static const std::byte* Varint(const std::byte* in, std::uint64_t& value) {
+        value = 0;
+        for (unsigned shift = 0;; shift += 7) {
+            auto byte = static_cast<std::uint64_t>(*in++);
+            value |= (byte & 0x7f) << shift;
+            if (!(byte & 0x80)) {
+                return in;
+            }
+        }
+    }
+
+    struct Message {
+        std::uint64_t       time_;
+        std::uint32_t       device_;
+        std::vector<double> readings_;
+        std::string         tag_;
+    };
+
+    static std::size_t Encode(const Message& message, std::byte* out) {
+        auto begin = out;
+        out = Varint(out, (1 << 3) | 0);
+        out = Varint(out, message.time_);
+        out = Varint(out, (2 << 3) | 0);
+        out = Varint(out, message.device_);
+        out = Varint(out, (3 << 3) | 2);
+        out = Varint(out, message.readings_.size() * sizeof(double));
+        std::memcpy(out, message.readings_.data(), message.readings_.size() * sizeof(double));
+        out += message.readings_.size() * sizeof(double);
+        out = Varint(out, (4 << 3) | 2);
+        out = Varint(out, message.tag_.size());
+        std::memcpy(out, message.tag_.data(), message.tag_.size());
+        return static_cast<std::size_t>(out + message.tag_.size() - begin);
+    }
+
+    static Message Decode(const std::byte* in, std::size_t size) {
+        Message message;
+        auto end = in + size;
+        while (in < end) {
+            std::uint64_t key, value;
+            in = Varint(in, key);
+            switch (key >> 3) {
+            case 1: in = Varint(in, message.time_); break;
+            case 2: in = Varint(in, value); message.device_ = static_cast<std::uint32_t>(value); break;
+            case 3:
+                in = Varint(in, value);
+                message.readings_.resize(value / sizeof(double));
+                std::memcpy(message.readings_.data(), in, value);
+                in += value;
+                break;
+            case 4:
+                in = Varint(in, value);
+                message.tag_.assign(reinterpret_cast<const char*>(in), value);
+                in += value;
+                break;
+            }
+        }
+        return message;
+    }
+}
+
+static void BM_Codec_Encode(benchmark::State& state) {
+    auto sample = Make_sample();
+    std::byte buffer[256];
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(codec<Sample>::encode(sample, buffer));
+        benchmark::ClobberMemory();
+    }
+    state.counters["bytes"] = static_cast<double>(codec<Sample>::size(sample));
+}
+BENCHMARK(BM_Codec_Encode);
+
+static void BM_Proto_Encode(benchmark::State& state) {
+    auto sample = Make_sample();
+    proto::Message message{std::get<0>(sample.args_), std::get<1>(sample.args_), std::get<2>(sample.args_), std::get<3>(sample.args_)};
+    std::byte buffer[256];
+    std::size_t size = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(size = proto::Encode(message, buffer));
+        benchmark::ClobberMemory();
+    }
+    state.counters["bytes"] = static_cast<double>(size);
+}
+BENCHMARK(BM_Proto_Encode);
+
+static void BM_Codec_Decode(benchmark::State& state) {
+    std::vector<std::byte> bytes;
+    codec<Sample>::encode(Make_sample(), bytes);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(codec<Sample>::decode(bytes));
+    }
+}
+BENCHMARK(BM_Codec_Decode);
+
+static void BM_Proto_Decode(benchmark::State& state) {
+    auto sample = Make_sample();
+    proto::Message message{std::get<0>(sample.args_), std::get<1>(sample.args_), std::get<2>(sample.args_), std::get<3>(sample.args_)};
+    std::byte buffer[256];
+    auto size = proto::Encode(message, buffer);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(proto::Decode(buffer, size));
+    }
+}
+BENCHMARK(BM_Proto_Decode);
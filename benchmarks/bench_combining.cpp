@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+#include <stdexec/execution.hpp>
+#include <atomic>
+#include "signal.hpp"
+
+using namespace daking;
+using namespace stdexec;
+
+struct PlainHot    : signal<int> { using base::base; };
+struct CombinedHot : combining_signal<int> { using base::base; };
+
+class HotEngine : public enable_signal<PlainHot, CombinedHot> {};
+
+// The counter each slot bumps, on a line of its own.
+struct alignas(64) HotCounter {
+    std::atomic<long> value_{0};
+};
+
+static HotEngine*  engine   = nullptr;
+static HotCounter* counters = nullptr;
+
+template <typename Signal>
+static void Setup(int slots) {
+    engine   = new HotEngine;
+    counters = new HotCounter[slots];
+    for (int i = 0; i < slots; ++i) {
+        daking::connect<Signal>(*engine, then([c = &counters[i]](int n) {
+            c->value_.fetch_add(n, std::memory_order_relaxed);
+        }));
+    }
+}
+
+static void Teardown() {
+    delete engine;
+    delete[] counters;
+}
+
+// Every thread emits the same signal to the same slots: each broadcast loads the shared snapshot and walks
+// the slot list itself, or publishes its emission and lets the combiner walk the list once per batch.
+template <typename Signal>
+static void BM_Hot_Emit(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        Setup<Signal>(state.range(0));
+    }
+    for (auto _ : state) {
+        emit(Signal{1}, daking::broadcast, *engine);
+    }
+    if (state.thread_index() == 0) {
+        Teardown();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_Hot_Emit, PlainHot)->Arg(4)->Arg(16)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Hot_Emit, CombinedHot)->Arg(4)->Arg(16)->ThreadRange(1, 16)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+#include <stdexec/execution.hpp>
+#include <memory>
+#include "signal.hpp"
+
+using namespace daking;
+using namespace stdexec;
+
+// The signals of a per-order object: most instances never get a subscriber.
+struct Filled   : signal<std::uint64_t, double> { using base::base; };
+struct Canceled : signal<std::uint64_t> { using base::base; };
+struct Expired  : signal<void> {};
+
+struct RegularOrder : enable_signal<Filled, Canceled, Expired> {};
+struct CompactOrder : compact_emitter<Filled, Canceled, Expired> {};
+
+template <typename Order>
+static std::size_t Footprint(const Order& order) {
+    if constexpr (requires { order.footprint(); }) {
+        return order.footprint();
+    }
+    else {
+        return sizeof(Order);
+    }
+}
+
+static constexpr std::size_t BATCH = 1024;
+
+// Allocates, constructs, destroys and frees a batch of emitters nobody connects to.
+template <typename Order>
+static void BM_Construct_Destroy(benchmark::State& state) {
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        auto orders = std::make_unique<Order[]>(BATCH);
+        benchmark::DoNotOptimize(orders.get());
+        bytes = Footprint(orders[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * BATCH);
+    state.counters["bytes_per_instance"] = static_cast<double>(bytes);
+}
+BENCHMARK_TEMPLATE(BM_Construct_Destroy, RegularOrder);
+BENCHMARK_TEMPLATE(BM_Construct_Destroy, CompactOrder);
+
+// Every instance gets one slot, so the compact emitter also pays for its side table.
+template <typename Order>
+static void BM_Construct_Connect_Destroy(benchmark::State& state) {
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        auto orders = std::make_unique<Order[]>(BATCH);
+        for (std::size_t i = 0; i < BATCH; i++) {
+            daking::connect<Filled>(orders[i], then([](std::uint64_t, double) {}));
+        }
+        bytes = Footprint(orders[0]);
+    }
+    if constexpr (std::same_as<Order, CompactOrder>) {
+        join_compact_emitters();
+    }
+    state.SetItemsProcessed(state.iterations() * BATCH);
+    state.counters["bytes_per_instance"] = static_cast<double>(bytes);
+}
+BENCHMARK_TEMPLATE(BM_Construct_Connect_Destroy, RegularOrder);
+BENCHMARK_TEMPLATE(BM_Construct_Connect_Destroy, CompactOrder);
+
+// Emitting on an instance without subscribers: a null check for the compact emitter.
+template <typename Order>
+static void BM_Emit_Unconnected(benchmark::State& state) {
+    Order order;
+    for (auto _ : state) {
+        emit(Filled{42, 1.0}, daking::broadcast, order);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_Emit_Unconnected, RegularOrder);
+BENCHMARK_TEMPLATE(BM_Emit_Unconnected, CompactOrder);
+
+// Emitting to one slot: one more dependent load for the compact emitter.
+template <typename Order>
+static void BM_Emit_Connected(benchmark::State& state) {
+    Order order;
+    daking::connect<Filled>(order, then([](std::uint64_t, double) {}));
+    for (auto _ : state) {
+        emit(Filled{42, 1.0}, daking::broadcast, order);
+    }
+    if constexpr (std::same_as<Order, CompactOrder>) {
+        join_compact_emitters();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_Emit_Connected, RegularOrder);
+BENCHMARK_TEMPLATE(BM_Emit_Connected, CompactOrder);
@@ -28,6 +28,29 @@ BENCHMARK(BM_Signal_Dispatch_Overhead)
     ->Arg(1000)
     ->UseRealTime();
 
+struct KeyedBenchSignal : keyed_signal<int, int> { using base::base; };
+
+class KeyedBenchEngine : public enable_signal<KeyedBenchSignal> {};
+
+// One slot per key: the emission visits a single bucket whatever the key count.
+static void BM_Signal_Keyed_Dispatch_Overhead(benchmark::State& state) {
+    const size_t KEYS_NUM = state.range(0);
+    KeyedBenchEngine engine;
+    for(int i = 0; i < KEYS_NUM; ++i) {
+        daking::connect<KeyedBenchSignal>(engine, i, then([](int, int){}));
+    }
+
+    for (auto _ : state) {
+        emit(KeyedBenchSignal{42, 0}, daking::broadcast, engine);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Signal_Keyed_Dispatch_Overhead)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->UseRealTime();
+
 BENCHMARK_MAIN();
 
 /*
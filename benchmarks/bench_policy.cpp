@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+#include <stdexec/execution.hpp>
+#include <vector>
+#include "signal.hpp"
+
+using namespace daking;
+using namespace stdexec;
+
+struct PolicySignal : signal<int> { using base::base; };
+
+// The same emitter under both threading policies.
+struct SharedEngine : enable_signal<PolicySignal> {};
+struct LocalEngine  : enable_signal<single_threaded, PolicySignal> {};
+
+// Broadcast to N slots: an atomic snapshot load and N atomic flag reads, or a plain load and N plain reads.
+template <typename Engine>
+static void BM_Policy_Emit(benchmark::State& state) {
+    Engine engine;
+    for (int i = 0; i < state.range(0); ++i) {
+        daking::connect<PolicySignal>(engine, then([](int) {}));
+    }
+
+    for (auto _ : state) {
+        emit(PolicySignal{42}, daking::broadcast, engine);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Policy_Emit, SharedEngine)->Arg(1)->Arg(10)->Arg(100);
+BENCHMARK_TEMPLATE(BM_Policy_Emit, LocalEngine)->Arg(1)->Arg(10)->Arg(100);
+
+// Connect and disconnect one slot next to N others: two COW copies published by CAS, or by plain stores.
+template <typename Engine>
+static void BM_Policy_Connect_Disconnect(benchmark::State& state) {
+    Engine engine;
+    for (int i = 0; i < state.range(0); ++i) {
+        daking::connect<PolicySignal>(engine, then([](int) {}));
+    }
+
+    for (auto _ : state) {
+        auto con = daking::connect<PolicySignal>(engine, then([](int) {}));
+        daking::disconnect<PolicySignal>(engine, con);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_Policy_Connect_Disconnect, SharedEngine)->Arg(0)->Arg(100);
+BENCHMARK_TEMPLATE(BM_Policy_Connect_Disconnect, LocalEngine)->Arg(0)->Arg(100);
+
+// Toggling a connection: weak_ptr::lock plus an atomic store, or a flag check and a plain store.
+template <typename Engine>
+static void BM_Policy_Toggle(benchmark::State& state) {
+    Engine engine;
+    auto con = daking::connect<PolicySignal>(engine, then([](int) {}));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(con.disable());
+        benchmark::DoNotOptimize(con.enable());
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK_TEMPLATE(BM_Policy_Toggle, SharedEngine);
+BENCHMARK_TEMPLATE(BM_Policy_Toggle, LocalEngine);
+
+// Copying handles around, as a reactor storing them in its own tables does: weak or shared counts, both atomic.
+template <typename Engine>
+static void BM_Policy_Handle_Copy(benchmark::State& state) {
+    Engine engine;
+    auto con = daking::connect<PolicySignal>(engine, then([](int) {}));
+    std::vector<decltype(con)> handles;
+    handles.reserve(64);
+
+    for (auto _ : state) {
+        for (int i = 0; i < 64; ++i) {
+            handles.push_back(con);
+        }
+        handles.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * 64);
+}
+BENCHMARK_TEMPLATE(BM_Policy_Handle_Copy, SharedEngine);
+BENCHMARK_TEMPLATE(BM_Policy_Handle_Copy, LocalEngine);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+#include <stdexec/execution.hpp>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include "signal.hpp"
+
+using namespace daking;
+using namespace stdexec;
+
+struct BroadcastTick : signal<int, double> { using base::base; };
+struct RingTick      : ring_signal<int, double> { 
+    using base::base; 
+    static constexpr std::size_t ring_capacity = 4096;
+};
+
+class BroadcastEngine : public enable_signal<BroadcastTick> {};
+class RingEngine      : public enable_signal<RingTick> {};
+
+// Emissions per timed iteration; each iteration ends only once every consumer has seen the last one.
+static constexpr int BATCH = 1024;
+
+struct alignas(64) Progress {
+    std::atomic<int> last_{-1};
+};
+
+static void Wait_all(const std::unique_ptr<Progress[]>& progress, int consumers, int last) {
+    for (int i = 0; i < consumers; ++i) {
+        while (progress[i].last_.load(std::memory_order_acquire) != last) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+// Copy-on-write slot list: one copy of the arguments and one spawn per consumer per emission.
+static void BM_Signal_Broadcast_Throughput(benchmark::State& state) {
+    const int CONSUMERS_NUM = state.range(0);
+    auto progress = std::make_unique<Progress[]>(CONSUMERS_NUM);
+    BroadcastEngine engine;
+    for (int i = 0; i < CONSUMERS_NUM; ++i) {
+        daking::connect<BroadcastTick>(engine, then([p = &progress[i]](int seq, double) {
+            p->last_.store(seq, std::memory_order_release);
+        }));
+    }
+
+    int seq = 0;
+    for (auto _ : state) {
+        for (int i = 0; i < BATCH; ++i) {
+            emit(BroadcastTick{seq++, 1.0}, daking::broadcast, engine);
+        }
+        Wait_all(progress, CONSUMERS_NUM, seq - 1);
+    }
+    state.SetItemsProcessed(state.iterations() * BATCH);
+}
+BENCHMARK(BM_Signal_Broadcast_Throughput)
+    ->Arg(1)
+    ->Arg(4)
+    ->Arg(16)
+    ->UseRealTime();
+
+// Ring: one in-place write per emission; each consumer thread reads it through its own cursor.
+// The timed region includes the consumers catching up, so both benchmarks measure full delivery.
+static void BM_Signal_Ring_Throughput(benchmark::State& state) {
+    const int CONSUMERS_NUM = state.range(0);
+    auto progress = std::make_unique<Progress[]>(CONSUMERS_NUM);
+    RingEngine engine;
+    for (int i = 0; i < CONSUMERS_NUM; ++i) {
+        daking::connect<RingTick>(engine, then([p = &progress[i]](int seq, double) {
+            p->last_.store(seq, std::memory_order_release);
+        }));
+    }
+
+    int seq = 0;
+    for (auto _ : state) {
+        for (int i = 0; i < BATCH; ++i) {
+            emit(RingTick{seq++, 1.0}, daking::broadcast, engine);
+        }
+        Wait_all(progress, CONSUMERS_NUM, seq - 1);
+    }
+    state.SetItemsProcessed(state.iterations() * BATCH);
+}
+BENCHMARK(BM_Signal_Ring_Throughput)
+    ->Arg(1)
+    ->Arg(4)
+    ->Arg(16)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
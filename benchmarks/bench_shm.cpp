@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+#include <hdr/hdr_histogram.h>
+#include <stdexec/execution.hpp>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include "signal_shm.hpp"
+
+#include <sched.h>
+#include <pthread.h>
+#include <unistd.h>
+
+using namespace daking;
+using namespace stdexec;
+
+void pin_thread(int cpu_id) {
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(cpu_id, &cpuset);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+}
+
+struct Ping : signal<std::uint64_t, double> { using base::base; };
+
+// Ping-pong through two shared memory rings: the echo side's reader thread republishes every ping
+// on the pong ring, whose reader completes the round trip. The ring, futex and reader path are the
+// same as across processes; one-way latency is reported as half the round trip.
+static void BM_Shm_PingPong_Latency_HDR(benchmark::State& state) {
+    auto ping_name = "/daking_bench_ping_" + std::to_string(::getpid());
+    auto pong_name = "/daking_bench_pong_" + std::to_string(::getpid());
+    shm_publisher<Ping> ping(ping_name, 1024);
+    shm_publisher<Ping> pong(pong_name, 1024);
+    shm_subscriber<Ping> echo(ping_name);
+    shm_subscriber<Ping> back(pong_name);
+
+    std::atomic<std::uint64_t> returned{0};
+    daking::connect<Ping>(echo, pong.forward());
+    daking::connect<Ping>(back, then([&](std::uint64_t seq, double) { returned.store(seq, std::memory_order_release); }));
+    echo.start();
+    back.start();
+
+    hdr_histogram* hist;
+    hdr_init(1, 100000000, 3, &hist);
+    pin_thread(0);
+
+    std::uint64_t seq = 0;
+    for (auto _ : state) {
+        for (int i = 0; i < 1000; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            ping.publish(Ping{++seq, 1.0});
+            for (std::size_t round = 0; returned.load(std::memory_order_acquire) != seq; round++) {
+                detail::spin_pause(round);
+            }
+            auto end = std::chrono::steady_clock::now();
+            hdr_record_value(hist, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / 2);
+        }
+    }
+
+    state.counters["P50_ns"]   = hdr_value_at_percentile(hist, 50.0);
+    state.counters["P99_ns"]   = hdr_value_at_percentile(hist, 99.0);
+    state.counters["P99.9_ns"] = hdr_value_at_percentile(hist, 99.9);
+
+    hdr_close(hist);
+}
+
+BENCHMARK(BM_Shm_PingPong_Latency_HDR)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -37,11 +37,44 @@ SOFTWARE.
 #   endif
 #endif // !DAKING_ALWAYS_INLINE
 
+#ifndef DAKING_NO_UNIQUE_ADDRESS
+#   if defined(_MSC_VER)
+#       define DAKING_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#   else
+#       define DAKING_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#   endif
+#endif // !DAKING_NO_UNIQUE_ADDRESS
+
 #include <stdexec/execution.hpp>
 #include <exec/async_scope.hpp>
+#include <exec/static_thread_pool.hpp>
 #include <vector>
 #include <algorithm>
 #include <memory>
+#include <chrono>
+#include <concepts>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
+#include <optional>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <string>
+#include <string_view>
+#include <stdexcept>
+#include <cassert>
+#include <array>
+#include <new>
+#include <memory_resource>
+#include <fstream>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <pthread.h>
+#endif
 
 namespace daking {
     namespace detail {
@@ -69,6 +102,38 @@ namespace daking {
             static constexpr bool is_void_signal = true;
         };
 
+        // The first argument routes the emission: connect under a key and only that key's slots are visited.
+        template <typename Key, signal_arg...Args>
+        struct keyed_signal : signal<Key, Args...> {
+            using base     = keyed_signal<Key, Args...>;
+            using key_type = Key;
+
+            using signal<Key, Args...>::signal;
+        };
+
+        // Emissions are written once into a preallocated ring that every consumer reads through its own cursor.
+        // Derived signals may shadow ring_capacity (a power of two) to resize the ring.
+        template <signal_arg...Args>
+            requires (std::default_initializable<Args> && ...)
+        struct ring_signal : signal<Args...> {
+            using base = ring_signal<Args...>;
+            static constexpr std::size_t ring_capacity = 1024;
+
+            using signal<Args...>::signal;
+        };
+
+        // For signals many threads emit at once. Each producer publishes its arguments in a record of its own,
+        // and whichever producer holds the combiner lock broadcasts every pending emission in one pass over the
+        // slots. Derived signals may shadow combining_records, the number of threads that can publish at once;
+        // threads beyond it broadcast directly.
+        template <signal_arg...Args>
+        struct combining_signal : signal<Args...> {
+            using base = combining_signal<Args...>;
+            static constexpr std::size_t combining_records = 64;
+
+            using signal<Args...>::signal;
+        };
+
         inline constexpr auto signal_cast = []<typename... Args>(signal<Args...>*) consteval -> signal<Args...>  {
             return {};
         };
@@ -89,36 +154,280 @@ namespace daking {
         template <typename S>
         concept emittable = (!std::same_as<signal_degradation_t<S>, void>);
 
-        template <emittable Signal>
+        // Stands in for std::atomic in the units of a single-threaded emitter: the same interface over plain accesses.
+        template <typename T>
+        struct plain_atomic {
+            plain_atomic() = default;
+            plain_atomic(T value) noexcept(std::is_nothrow_move_constructible_v<T>) : value_(std::move(value)) {}
+
+            plain_atomic(const plain_atomic&)            = delete;
+            plain_atomic& operator=(const plain_atomic&) = delete;
+
+            DAKING_ALWAYS_INLINE T load(std::memory_order = std::memory_order_seq_cst) const noexcept {
+                return value_;
+            }
+
+            DAKING_ALWAYS_INLINE void store(T value, std::memory_order = std::memory_order_seq_cst) noexcept {
+                value_ = std::move(value);
+            }
+
+            T exchange(T value, std::memory_order = std::memory_order_seq_cst) noexcept {
+                std::swap(value_, value);
+                return value;
+            }
+
+            bool compare_exchange_weak(T& expected, T desired,
+                std::memory_order = std::memory_order_seq_cst, std::memory_order = std::memory_order_seq_cst) noexcept {
+                if (value_ == expected) {
+                    value_ = std::move(desired);
+                    return true;
+                }
+                expected = value_;
+                return false;
+            }
+
+            bool compare_exchange_strong(T& expected, T desired,
+                std::memory_order success = std::memory_order_seq_cst, std::memory_order failure = std::memory_order_seq_cst) noexcept {
+                return compare_exchange_weak(expected, std::move(desired), success, failure);
+            }
+
+            T value_{};
+        };
+
+        // Debug builds check that a single-threaded emitter stays on the thread that first used it.
+        struct thread_confinement {
+#ifndef NDEBUG
+            void Check() noexcept {
+                auto current = std::this_thread::get_id();
+                if (owner_ == std::thread::id{}) {
+                    owner_ = current;
+                }
+                assert(owner_ == current && "A single_threaded emitter was used from a second thread.");
+            }
+
+            std::thread::id owner_;
+#else
+            DAKING_ALWAYS_INLINE void Check() noexcept {}
+#endif
+        };
+
+        // Threading policies, the optional first argument of enable_signal. They decide what the units, slots and
+        // connection handles of an emitter are made of. The default suits emitters shared between threads.
+        struct multi_threaded {
+            using threading_policy_tag = void;
+
+            template <typename T>
+            using atomic = std::atomic<T>;
+
+            // Handles observe their slot and lock it for each operation.
+            template <typename Slot>
+            using handle = std::weak_ptr<Slot>;
+
+            struct confinement {
+                DAKING_ALWAYS_INLINE void Check() noexcept {}
+            };
+
+            struct slot_state {
+                DAKING_ALWAYS_INLINE void Detach() noexcept {}
+            };
+        };
+
+        // For emitters that never leave one thread: slot lists, slot flags and the unit's writers use plain
+        // accesses, and handles share their slot, reading a plain flag instead of locking a weak_ptr. Ownership
+        // counts stay atomic, since the work a slot spawns may finish on another thread.
+        struct single_threaded {
+            using threading_policy_tag = void;
+
+            template <typename T>
+            using atomic = plain_atomic<T>;
+
+            template <typename Slot>
+            using handle = std::shared_ptr<Slot>;
+
+            using confinement = thread_confinement;
+
+            // Cleared once the slot is closed, which handles report as the slot being gone.
+            struct slot_state {
+                DAKING_ALWAYS_INLINE void Detach() noexcept {
+                    connected_ = false;
+                }
+
+                bool connected_ = true;
+            };
+        };
+
+        template <typename T>
+        concept threading_policy = requires { typename T::threading_policy_tag; };
+
+        template <emittable Signal, typename Threading = multi_threaded>
         struct emitter_unit;
 
         struct emitter_scope;
 
-        template <emittable... Signals>
+        template <typename Threading, emittable... Signals>
         struct emitter_impl;
 
+        // The threading policy an emitter was declared with; hosts of out-of-line units take the default.
+        template <typename E>
+        struct threading_of {
+            using type = multi_threaded;
+        };
+
+        template <typename E>
+            requires requires { typename E::threading; }
+        struct threading_of<E> {
+            using type = typename E::threading;
+        };
+
+        template <typename E, typename Signal>
+        using unit_of_t = emitter_unit<Signal, typename threading_of<E>::type>;
+
+        // Emitters that hold the unit of Signal inline.
+        template <typename E, typename Signal>
+        concept unit_of = std::derived_from<E, unit_of_t<E, Signal>>;
+
         template <typename E>
         concept emitter = std::derived_from<E, emitter_scope>;
 
+        template <typename S>
+        concept keyed = emittable<S> && requires { typename S::key_type; };
+
+        template <typename S>
+        concept ring_backed = emittable<S> && requires { { S::ring_capacity } -> std::convertible_to<std::size_t>; };
+
+        template <typename S>
+        concept combined = emittable<S> && requires { { S::combining_records } -> std::convertible_to<std::size_t>; };
+
+        // The combiner of a combining signal's unit; an empty placeholder for other signals.
         template <emittable Signal>
+        struct combiner_of;
+
+        template <emittable Signal, typename Threading = multi_threaded>
         struct slot_base;
 
-        template <emittable Signal, typename SenderClosure>
+        struct capture_env;
+
+        struct no_policy {
+            using connection_policy_tag = void;
+
+            template <typename Slot>
+            struct gate {
+                gate(const no_policy&) noexcept {}
+
+                template <typename...Args>
+                DAKING_ALWAYS_INLINE bool Admit(Slot&, exec::async_scope*, const Args&...) noexcept {
+                    return true;
+                }
+
+                void Close() noexcept {}
+            };
+        };
+
+        template <emittable Signal, typename SenderClosure, typename Policy = no_policy, typename Threading = multi_threaded>
         struct slot_impl;
 
+        template <typename Policy>
+        concept connection_policy = requires { typename std::remove_cvref_t<Policy>::connection_policy_tag; };
+
+        template <typename Strategy>
+        struct consumer_group;
+
+        // A consumer group is connected like a policy, but joins a shared composite slot instead of gating its own.
+        template <typename Policy>
+        concept grouping = connection_policy<Policy> && requires { typename std::remove_cvref_t<Policy>::consumer_group_tag; };
+
+        template <emittable Signal, typename Strategy, typename Threading = multi_threaded>
+        struct slot_group;
+
+        // A placement is connected like a policy, but puts the slot in the partition of a NUMA node.
+        template <typename Policy>
+        concept placing = connection_policy<Policy> && requires { typename std::remove_cvref_t<Policy>::numa_placement_tag; };
+
+        template <emittable Signal>
+        struct slot_partitions;
+
+        template <typename Predicate>
+        struct filter;
+
+        template <std::size_t I, typename T>
+        struct arg_equal;
+
+        template <emittable Signal, std::size_t I, typename Key, typename Threading = multi_threaded>
+        struct slot_index;
+
+        template <typename Predicate, typename Signal>
+        struct is_signal_predicate {
+            static constexpr bool value = false;
+        };
+
+        template <typename Predicate, typename...Args>
+        struct is_signal_predicate<Predicate, signal<Args...>> {
+            static constexpr bool value = std::predicate<const Predicate&, const Args&...>;
+        };
+
+        template <typename Predicate>
+        struct is_signal_predicate<Predicate, signal<void>> {
+            static constexpr bool value = std::predicate<const Predicate&>;
+        };
+
+        template <typename Predicate, typename Signal>
+        concept signal_predicate = is_signal_predicate<std::decay_t<Predicate>, signal_degradation_t<Signal>>::value;
+
         template <emittable Signal>
         struct connect_t;
 
+        template <emittable Signal>
+        struct connect_if_t;
+
         template <emittable Signal>
         struct disconnect_t;
 
+        template <emittable Signal>
+        struct topic_unit;
+
+        template <emittable Signal>
+        struct subscribe_t;
+
+        template <emittable Signal>
+        struct unsubscribe_t;
+
         struct emit_t;
 
+        struct publish_t;
+
+        struct drain_t;
+
+        struct event_bus_impl;
+
+        template <emittable Signal>
+        struct compact_unit;
+
+        // Emitters whose units live out of line and come into being on the first connect.
+        template <typename E, typename Signal>
+        concept unit_host = std::derived_from<E, event_bus_impl> || std::derived_from<E, compact_unit<Signal>>;
+
+        template <emittable Signal, std::size_t Capacity, std::size_t Bytes>
+        struct fixed_unit;
+
+        // Fixed emitters publish their sizes, which name the unit each of their signals lives in.
+        template <typename E, typename Signal>
+        concept fixed_host = requires { E::slot_capacity; E::closure_bytes; }
+            && std::derived_from<E, fixed_unit<Signal, E::slot_capacity, E::closure_bytes>>;
+
+        template <typename E, typename Signal>
+        using fixed_unit_of = fixed_unit<Signal, E::slot_capacity, E::closure_bytes>;
+
+        template <emittable Signal>
+        struct fixed_connection;
+
+        // Lets transports in sibling headers broadcast arguments they already hold, without building a signal.
+        struct unit_access;
+
         struct broadcast_t{};
 
         struct capture_t{/*...*/};
 
-        template <emittable Signal, typename SenderClosure>
+        template <emittable Signal, typename SenderClosure, typename Threading = multi_threaded>
         struct connection_signatures;
 
         template <typename Connection, emittable Signal>
@@ -126,8 +435,8 @@ namespace daking {
             static constexpr bool value = false;
         };
 
-        template <emittable Signal, typename SenderClosure>
-        struct is_connection_signatures<connection_signatures<Signal, SenderClosure>, Signal> {
+        template <emittable Signal, typename SenderClosure, typename Threading>
+        struct is_connection_signatures<connection_signatures<Signal, SenderClosure, Threading>, Signal> {
             static constexpr bool value = true;
         };
 
@@ -137,12 +446,13 @@ namespace daking {
         template <typename Connection, typename Signal>
         concept connection = is_connection_signatures_v<Connection, Signal>;
 
-        template <emittable Signal, typename SenderClosure>
+        template <emittable Signal, typename SenderClosure, typename Threading>
         struct connection_signatures {
-            using weak_slot = std::weak_ptr<slot_base<signal_degradation_t<Signal>>>;
+            using slot_type   = slot_base<signal_degradation_t<Signal>, Threading>;
+            using slot_handle = typename Threading::template handle<slot_type>;
 
             DAKING_ALWAYS_INLINE bool enable() const noexcept {
-                auto slot = ptr_.lock();
+                auto slot = Lock();
                 if (!slot) {
                     return false;
                 }
@@ -151,7 +461,7 @@ namespace daking {
             }
 
             DAKING_ALWAYS_INLINE bool disable() const noexcept {
-                auto slot = ptr_.lock();
+                auto slot = Lock();
                 if (!slot) {
                     return false;
                 }
@@ -159,75 +469,329 @@ namespace daking {
                 return true;
             }
 
+            // Swaps the slot's closure in place: the slot keeps its position, enabled state and this handle,
+            // and work already spawned finishes on the previous closure.
+            bool replace(SenderClosure closure) const {
+                auto slot = Lock();
+                if (!slot) {
+                    return false;
+                }
+                return slot->Replace(&closure);
+            }
+
+            // The NUMA node a numa_local connection was placed on; -1 for other connections and once the slot is gone.
+            int node() const noexcept {
+                auto slot = Lock();
+                return slot && slot->Control() ? slot->Control()->node_ : -1;
+            }
+
         private:
-            friend struct emitter_unit<Signal>;
+            friend struct emitter_unit<Signal, Threading>;
             friend struct connect_t<Signal>;
+            friend struct connect_if_t<Signal>;
             friend struct disconnect_t<Signal>;
+            friend struct subscribe_t<Signal>;
+            friend struct unsubscribe_t<Signal>;
             friend struct emit_t;
+            friend struct drain_t;
 
-            connection_signatures(weak_slot&& ptr, exec::async_scope* scope) 
+            connection_signatures(slot_handle&& ptr, exec::async_scope* scope) 
                 : ptr_(std::move(ptr)), scope_(scope) {}
+
+            // The slot while it is connected: a locked reference, or a plain pointer for a single-threaded emitter.
+            DAKING_ALWAYS_INLINE auto Lock() const noexcept {
+                if constexpr (std::same_as<slot_handle, std::shared_ptr<slot_type>>) {
+                    return ptr_->connected_ ? ptr_.get() : nullptr;
+                }
+                else {
+                    return ptr_.lock();
+                }
+            }
+
+            // The slot for as long as anything holds it, connected or not.
+            std::shared_ptr<slot_type> Share() const noexcept {
+                if constexpr (std::same_as<slot_handle, std::shared_ptr<slot_type>>) {
+                    return ptr_;
+                }
+                else {
+                    return ptr_.lock();
+                }
+            }
             
-            weak_slot          ptr_;
+            slot_handle        ptr_;
             exec::async_scope* scope_;
         };
 
         template <emittable Signal>
         struct connect_t {
         public:
-            template <std::derived_from<emitter_unit<Signal>> E, typename SenderClosure>
+            template <unit_of<Signal> E, typename SenderClosure>
                 requires (std::copy_constructible<SenderClosure> &&
                     (!Signal::is_void_signal && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>> 
                     || Signal::is_void_signal && stdexec::sender<SenderClosure>))
             DAKING_ALWAYS_INLINE 
-            connection_signatures<Signal, SenderClosure> operator()(E* emitter, SenderClosure&& sender_closure) const {
-                return Impl<SenderClosure>(emitter, &emitter->scope_, std::forward<SenderClosure>(sender_closure));
+            connection_signatures<Signal, SenderClosure, typename threading_of<E>::type> operator()(E* emitter, SenderClosure&& sender_closure) const {
+                return Impl<SenderClosure>(emitter, emitter->Open_scope(), std::forward<SenderClosure>(sender_closure));
             }
 
-            template <std::derived_from<emitter_unit<Signal>> E, typename SenderClosure>
+            template <unit_of<Signal> E, typename SenderClosure>
                 requires (std::copy_constructible<SenderClosure> &&
                     (!Signal::is_void_signal && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>> 
                     || Signal::is_void_signal && stdexec::sender<SenderClosure>))
             DAKING_ALWAYS_INLINE 
-            connection_signatures<Signal, SenderClosure> operator()(E& emitter, SenderClosure&& sender_closure) const {
-                return Impl<SenderClosure>(&emitter, &emitter.scope_, std::forward<SenderClosure>(sender_closure));
+            connection_signatures<Signal, SenderClosure, typename threading_of<E>::type> operator()(E& emitter, SenderClosure&& sender_closure) const {
+                return Impl<SenderClosure>(&emitter, emitter.Open_scope(), std::forward<SenderClosure>(sender_closure));
+            }
+
+            template <unit_of<Signal> E, connection_policy Policy, typename SenderClosure>
+                requires (std::copy_constructible<SenderClosure> &&
+                    (!Signal::is_void_signal && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>>
+                    || Signal::is_void_signal && stdexec::sender<SenderClosure>))
+            DAKING_ALWAYS_INLINE
+            connection_signatures<Signal, SenderClosure, typename threading_of<E>::type> operator()(E* emitter, Policy&& policy, SenderClosure&& sender_closure) const {
+                return Impl<SenderClosure>(emitter, emitter->Open_scope(), std::forward<Policy>(policy), std::forward<SenderClosure>(sender_closure));
+            }
+
+            template <unit_of<Signal> E, connection_policy Policy, typename SenderClosure>
+                requires (std::copy_constructible<SenderClosure> &&
+                    (!Signal::is_void_signal && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>>
+                    || Signal::is_void_signal && stdexec::sender<SenderClosure>))
+            DAKING_ALWAYS_INLINE
+            connection_signatures<Signal, SenderClosure, typename threading_of<E>::type> operator()(E& emitter, Policy&& policy, SenderClosure&& sender_closure) const {
+                return Impl<SenderClosure>(&emitter, emitter.Open_scope(), std::forward<Policy>(policy), std::forward<SenderClosure>(sender_closure));
+            }
+
+            template <unit_host<Signal> Host, typename SenderClosure>
+                requires (std::copy_constructible<SenderClosure> &&
+                    (!Signal::is_void_signal && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>>
+                    || Signal::is_void_signal && stdexec::sender<SenderClosure>))
+            DAKING_ALWAYS_INLINE
+            connection_signatures<Signal, SenderClosure> operator()(Host* host, SenderClosure&& sender_closure) const {
+                emitter_unit<Signal>* unit = host->template Find_or_add<Signal>();
+                return Impl<SenderClosure>(unit, host->Scope(), std::forward<SenderClosure>(sender_closure));
+            }
+
+            template <unit_host<Signal> Host, typename SenderClosure>
+                requires (std::copy_constructible<SenderClosure> &&
+                    (!Signal::is_void_signal && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>>
+                    || Signal::is_void_signal && stdexec::sender<SenderClosure>))
+            DAKING_ALWAYS_INLINE
+            connection_signatures<Signal, SenderClosure> operator()(Host& host, SenderClosure&& sender_closure) const {
+                return this->operator()(&host, std::forward<SenderClosure>(sender_closure));
+            }
+
+            template <unit_host<Signal> Host, connection_policy Policy, typename SenderClosure>
+                requires (std::copy_constructible<SenderClosure> &&
+                    (!Signal::is_void_signal && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>>
+                    || Signal::is_void_signal && stdexec::sender<SenderClosure>))
+            DAKING_ALWAYS_INLINE
+            connection_signatures<Signal, SenderClosure> operator()(Host* host, Policy&& policy, SenderClosure&& sender_closure) const {
+                emitter_unit<Signal>* unit = host->template Find_or_add<Signal>();
+                return Impl<SenderClosure>(unit, host->Scope(), std::forward<Policy>(policy), std::forward<SenderClosure>(sender_closure));
+            }
+
+            template <unit_host<Signal> Host, connection_policy Policy, typename SenderClosure>
+                requires (std::copy_constructible<SenderClosure> &&
+                    (!Signal::is_void_signal && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>>
+                    || Signal::is_void_signal && stdexec::sender<SenderClosure>))
+            DAKING_ALWAYS_INLINE
+            connection_signatures<Signal, SenderClosure> operator()(Host& host, Policy&& policy, SenderClosure&& sender_closure) const {
+                return this->operator()(&host, std::forward<Policy>(policy), std::forward<SenderClosure>(sender_closure));
+            }
+
+            // A full fixed emitter returns a handle that is not connected instead of throwing.
+            template <fixed_host<Signal> E, typename SenderClosure>
+                requires (std::copy_constructible<SenderClosure> &&
+                    (!Signal::is_void_signal && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>>
+                    || Signal::is_void_signal && stdexec::sender<SenderClosure>))
+            DAKING_ALWAYS_INLINE
+            fixed_connection<Signal> operator()(E* emitter, SenderClosure&& sender_closure) const {
+                fixed_unit_of<E, Signal>* unit = emitter;
+                return unit->Register(std::forward<SenderClosure>(sender_closure));
+            }
+
+            template <fixed_host<Signal> E, typename SenderClosure>
+                requires (std::copy_constructible<SenderClosure> &&
+                    (!Signal::is_void_signal && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>>
+                    || Signal::is_void_signal && stdexec::sender<SenderClosure>))
+            DAKING_ALWAYS_INLINE
+            fixed_connection<Signal> operator()(E& emitter, SenderClosure&& sender_closure) const {
+                return this->operator()(&emitter, std::forward<SenderClosure>(sender_closure));
+            }
+
+            template <unit_of<Signal> E, typename K, typename SenderClosure>
+                requires (keyed<Signal> && std::constructible_from<typename Signal::key_type, K> && std::copy_constructible<SenderClosure>
+                    && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>>)
+            DAKING_ALWAYS_INLINE
+            connection_signatures<Signal, SenderClosure, typename threading_of<E>::type> operator()(E* emitter, K&& key, SenderClosure&& sender_closure) const {
+                unit_of_t<E, Signal>* unit  = emitter;
+                exec::async_scope*    scope = emitter->Open_scope();
+                return {unit->template Register_indexed<arg_equal<0, typename Signal::key_type>>(
+                    std::forward<K>(key), std::forward<SenderClosure>(sender_closure)), scope};
+            }
+
+            template <unit_of<Signal> E, typename K, typename SenderClosure>
+                requires (keyed<Signal> && std::constructible_from<typename Signal::key_type, K> && std::copy_constructible<SenderClosure>
+                    && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>>)
+            DAKING_ALWAYS_INLINE
+            connection_signatures<Signal, SenderClosure, typename threading_of<E>::type> operator()(E& emitter, K&& key, SenderClosure&& sender_closure) const {
+                return this->operator()(&emitter, std::forward<K>(key), std::forward<SenderClosure>(sender_closure));
             }
 
         private:
-            template <typename SenderClosure>
+            template <typename SenderClosure, typename Threading>
             DAKING_ALWAYS_INLINE 
-            static connection_signatures<Signal, SenderClosure> Impl(
-                emitter_unit<Signal>* emitter, exec::async_scope* scope, SenderClosure&& sender_closure) {
-                    return {emitter->Register(std::forward<SenderClosure>(sender_closure)), scope};
+            static connection_signatures<Signal, SenderClosure, Threading> Impl(
+                emitter_unit<Signal, Threading>* emitter, exec::async_scope* scope, SenderClosure&& sender_closure) {
+                    return {emitter->Register(no_policy{}, std::forward<SenderClosure>(sender_closure)), scope};
+            }
+
+            template <typename SenderClosure, typename Threading, typename Policy>
+            DAKING_ALWAYS_INLINE
+            static connection_signatures<Signal, SenderClosure, Threading> Impl(
+                emitter_unit<Signal, Threading>* emitter, exec::async_scope* scope, Policy&& policy, SenderClosure&& sender_closure) {
+                    if constexpr (grouping<Policy>) {
+                        return {emitter->Register_grouped(std::forward<Policy>(policy), std::forward<SenderClosure>(sender_closure)), scope};
+                    }
+                    else if constexpr (placing<Policy>) {
+                        return {emitter->Register_placed(policy, std::forward<SenderClosure>(sender_closure)), scope};
+                    }
+                    else {
+                        return {emitter->Register(std::forward<Policy>(policy), std::forward<SenderClosure>(sender_closure)), scope};
+                    }
+            }
+        };
+
+        template <std::size_t I, typename T>
+        struct arg_equal {
+            static constexpr std::size_t index = I;
+
+            template <typename...Args>
+            DAKING_ALWAYS_INLINE bool operator()(const Args&...args) const {
+                return std::get<I>(std::forward_as_tuple(args...)) == value_;
+            }
+
+            T value_;
+        };
+
+        template <std::size_t I>
+        struct arg_equals_t {
+            template <typename T>
+            constexpr arg_equal<I, std::decay_t<T>> operator()(T&& value) const {
+                return {std::forward<T>(value)};
+            }
+        };
+
+        template <typename Predicate, typename Signal>
+        struct index_of {
+            static constexpr bool indexable = false;
+        };
+
+        // arg_equal<I> on a hashable argument shares one hash index per (signal, I) instead of a filter per slot.
+        template <std::size_t I, typename T, typename...Args>
+            requires (I < sizeof...(Args))
+        struct index_of<arg_equal<I, T>, signal<Args...>> {
+            using key = std::tuple_element_t<I, std::tuple<Args...>>;
+            static constexpr bool indexable = std::constructible_from<key, const T&> 
+                && std::equality_comparable<key> && requires(const key& k) { { std::hash<key>{}(k) } -> std::convertible_to<std::size_t>; };
+        };
+
+        template <emittable Signal>
+        struct connect_if_t {
+        public:
+            template <unit_of<Signal> E, signal_predicate<Signal> Predicate, typename SenderClosure>
+                requires (std::copy_constructible<SenderClosure> && std::copy_constructible<std::decay_t<Predicate>> &&
+                    (!Signal::is_void_signal && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>>
+                    || Signal::is_void_signal && stdexec::sender<SenderClosure>))
+            DAKING_ALWAYS_INLINE
+            connection_signatures<Signal, SenderClosure, typename threading_of<E>::type> operator()(E* emitter, Predicate&& predicate, SenderClosure&& sender_closure) const {
+                return Impl<SenderClosure>(emitter, emitter->Open_scope(), std::forward<Predicate>(predicate), std::forward<SenderClosure>(sender_closure));
+            }
+
+            template <unit_of<Signal> E, signal_predicate<Signal> Predicate, typename SenderClosure>
+                requires (std::copy_constructible<SenderClosure> && std::copy_constructible<std::decay_t<Predicate>> &&
+                    (!Signal::is_void_signal && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>>
+                    || Signal::is_void_signal && stdexec::sender<SenderClosure>))
+            DAKING_ALWAYS_INLINE
+            connection_signatures<Signal, SenderClosure, typename threading_of<E>::type> operator()(E& emitter, Predicate&& predicate, SenderClosure&& sender_closure) const {
+                return Impl<SenderClosure>(&emitter, emitter.Open_scope(), std::forward<Predicate>(predicate), std::forward<SenderClosure>(sender_closure));
+            }
+
+        private:
+            template <typename SenderClosure, typename Threading, typename Predicate>
+            DAKING_ALWAYS_INLINE
+            static connection_signatures<Signal, SenderClosure, Threading> Impl(
+                emitter_unit<Signal, Threading>* emitter, exec::async_scope* scope, Predicate&& predicate, SenderClosure&& sender_closure) {
+                    using index = index_of<std::decay_t<Predicate>, signal_degradation_t<Signal>>;
+                    if constexpr (index::indexable) {
+                        return {emitter->template Register_indexed<std::decay_t<Predicate>>(
+                            std::forward<Predicate>(predicate).value_, std::forward<SenderClosure>(sender_closure)), scope};
+                    }
+                    else {
+                        return {emitter->Register(filter<std::decay_t<Predicate>>{std::forward<Predicate>(predicate)},
+                            std::forward<SenderClosure>(sender_closure)), scope};
+                    }
             }
         };
 
         template <emittable Signal>
         struct disconnect_t {
         public:
-            template <typename SenderClosure>
+            template <typename SenderClosure, typename Threading>
                 requires (!Signal::is_void_signal && std::copy_constructible<SenderClosure> 
                     && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>> 
                     || Signal::is_void_signal && stdexec::sender<SenderClosure>)
             DAKING_ALWAYS_INLINE 
-            bool operator()(emitter_unit<Signal>* emitter, connection_signatures<Signal, SenderClosure>& con) const {
+            bool operator()(emitter_unit<Signal, Threading>* emitter, connection_signatures<Signal, SenderClosure, Threading>& con) const {
                 return Impl(emitter, con);
             }
 
-            template <typename SenderClosure>
+            template <typename SenderClosure, typename Threading>
                 requires (!Signal::is_void_signal && std::copy_constructible<SenderClosure> 
                     && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>> 
                     || Signal::is_void_signal && stdexec::sender<SenderClosure>)
             DAKING_ALWAYS_INLINE 
-            bool operator()(emitter_unit<Signal>& emitter, connection_signatures<Signal, SenderClosure>& con) const {
+            bool operator()(emitter_unit<Signal, Threading>& emitter, connection_signatures<Signal, SenderClosure, Threading>& con) const {
                 return Impl(&emitter, con);
             }
 
+            template <unit_host<Signal> Host, typename SenderClosure>
+                requires (!Signal::is_void_signal && std::copy_constructible<SenderClosure> 
+                    && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>> 
+                    || Signal::is_void_signal && stdexec::sender<SenderClosure>)
+            DAKING_ALWAYS_INLINE 
+            bool operator()(Host* host, connection_signatures<Signal, SenderClosure>& con) const {
+                emitter_unit<Signal>* unit = host->template Find<Signal>();
+                return unit && Impl(unit, con);
+            }
+
+            template <unit_host<Signal> Host, typename SenderClosure>
+                requires (!Signal::is_void_signal && std::copy_constructible<SenderClosure> 
+                    && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>> 
+                    || Signal::is_void_signal && stdexec::sender<SenderClosure>)
+            DAKING_ALWAYS_INLINE 
+            bool operator()(Host& host, connection_signatures<Signal, SenderClosure>& con) const {
+                return this->operator()(&host, con);
+            }
+
+            template <fixed_host<Signal> E>
+            DAKING_ALWAYS_INLINE
+            bool operator()(E* emitter, const fixed_connection<Signal>& con) const {
+                fixed_unit_of<E, Signal>* unit = emitter;
+                return unit->Unregister(con);
+            }
+
+            template <fixed_host<Signal> E>
+            DAKING_ALWAYS_INLINE
+            bool operator()(E& emitter, const fixed_connection<Signal>& con) const {
+                return this->operator()(&emitter, con);
+            }
+
         private:
-            template <typename SenderClosure>
+            template <typename SenderClosure, typename Threading>
             DAKING_ALWAYS_INLINE 
-            static bool Impl(emitter_unit<Signal>* emitter, connection_signatures<Signal, SenderClosure>& con) {
-                auto slot = con.ptr_.lock();
+            static bool Impl(emitter_unit<Signal, Threading>* emitter, connection_signatures<Signal, SenderClosure, Threading>& con) {
+                auto slot = con.Share();
                 if (!slot) {
                     return false;
                 }
@@ -239,19 +803,54 @@ namespace daking {
 
         struct emit_t {
         public:
-            template <emittable Signal, std::derived_from<emitter_unit<Signal>> Emitter>
+            template <emittable Signal, unit_of<Signal> Emitter>
+            DAKING_ALWAYS_INLINE void operator()(const Signal& signal, broadcast_t, Emitter* emitter) const {
+                if (!emitter->Is_closed()) [[likely]] {
+                    Broadcast<Signal>(signal, emitter, emitter->Scope());
+                }
+            }
+
+            template <emittable Signal, unit_of<Signal> Emitter>
+            DAKING_ALWAYS_INLINE void operator()(const Signal& signal, broadcast_t, Emitter& emitter) const {
+                this->operator()(signal, broadcast_t{}, &emitter);
+            }
+
+            // A fixed emitter has no scope: its slots run inline, and the call returns once they all finished.
+            template <emittable Signal, fixed_host<Signal> Emitter>
             DAKING_ALWAYS_INLINE void operator()(const Signal& signal, broadcast_t, Emitter* emitter) const {
-                Broadcast<Signal>(signal, emitter, &emitter->scope_);
+                fixed_unit_of<Emitter, Signal>* unit = emitter;
+                if constexpr (Signal::is_void_signal) {
+                    unit->Broadcast();
+                }
+                else {
+                    std::apply([&](const auto&...args){
+                        unit->Broadcast(args...);
+                    }, signal.args_);
+                }
             }
 
-            template <emittable Signal, std::derived_from<emitter_unit<Signal>> Emitter>
+            template <emittable Signal, fixed_host<Signal> Emitter>
             DAKING_ALWAYS_INLINE void operator()(const Signal& signal, broadcast_t, Emitter& emitter) const {
                 this->operator()(signal, broadcast_t{}, &emitter);
             }
 
+            // An out-of-line unit that was never connected to has nothing to broadcast to.
+            template <emittable Signal, unit_host<Signal> Host>
+            DAKING_ALWAYS_INLINE void operator()(const Signal& signal, broadcast_t, Host* host) const {
+                emitter_unit<Signal>* unit = host->template Find<Signal>();
+                if (unit) [[likely]] {
+                    Broadcast<Signal>(signal, unit, host->Scope());
+                }
+            }
+
+            template <emittable Signal, unit_host<Signal> Host>
+            DAKING_ALWAYS_INLINE void operator()(const Signal& signal, broadcast_t, Host& host) const {
+                this->operator()(signal, broadcast_t{}, &host);
+            }
+
             template <emitter Emitter>
             DAKING_ALWAYS_INLINE auto operator()(broadcast_t, Emitter* emitter) const {
-                return broadcast_emitter_closure<Emitter>{emitter, &emitter->scope_};
+                return broadcast_emitter_closure<Emitter>{emitter, emitter->Scope()};
             }
 
             template <emitter Emitter>
@@ -259,44 +858,49 @@ namespace daking {
                 return this->operator()(broadcast_t{}, &emitter);
             }
 
-            template <emittable Signal, std::derived_from<emitter_unit<Signal>> Emitter, typename...SenderClosures>
+            template <emittable Signal, unit_of<Signal> Emitter, typename...SenderClosures>
                 requires (sizeof...(SenderClosures) > 0)
             DAKING_ALWAYS_INLINE auto operator()(const Signal& signal, capture_t, 
-                Emitter* emitter, const connection_signatures<Signal, SenderClosures>&... cons) const {
-                return Capture<Signal>(signal, emitter, &emitter->scope_, cons...);
+                Emitter* emitter, const connection_signatures<Signal, SenderClosures, typename threading_of<Emitter>::type>&... cons) const {
+                if (emitter->Is_closed()) [[unlikely]] {
+                    specific_emission_sender<signal_degradation_t<Signal>, SenderClosures...> sender;
+                    sender.Emplace_error(std::runtime_error("Can't create sender: the emitter has been closed."));
+                    return sender;
+                }
+                return Capture<Signal>(signal, emitter, emitter->Scope(), cons...);
             }
 
-            template <emittable Signal, std::derived_from<emitter_unit<Signal>> Emitter, typename...SenderClosures>
+            template <emittable Signal, unit_of<Signal> Emitter, typename...SenderClosures>
                 requires (sizeof...(SenderClosures) > 0)
             DAKING_ALWAYS_INLINE auto operator()(const Signal& signal, capture_t,
-                 Emitter& emitter, const connection_signatures<Signal, SenderClosures>&... cons) const {
+                 Emitter& emitter, const connection_signatures<Signal, SenderClosures, typename threading_of<Emitter>::type>&... cons) const {
                 return this->operator()(signal, capture_t{}, &emitter, cons...);
             }
 
-            template <emittable Signal, std::derived_from<emitter_unit<Signal>> Emitter, typename...SenderClosures>
+            template <emittable Signal, unit_of<Signal> Emitter, typename...SenderClosures>
                 requires (sizeof...(SenderClosures) > 0)
             DAKING_ALWAYS_INLINE auto operator()(capture_t, 
-                Emitter* emitter, const connection_signatures<Signal, SenderClosures>&... cons) const {
-                return capture_emitter_closure<Signal, SenderClosures...>{emitter, &emitter->scope_, {cons...}};
+                Emitter* emitter, const connection_signatures<Signal, SenderClosures, typename threading_of<Emitter>::type>&... cons) const {
+                return capture_emitter_closure<Signal, typename threading_of<Emitter>::type, SenderClosures...>{emitter, emitter->Scope(), {cons...}};
             }
 
-            template <emittable Signal, std::derived_from<emitter_unit<Signal>> Emitter, typename...SenderClosures>
+            template <emittable Signal, unit_of<Signal> Emitter, typename...SenderClosures>
                 requires (sizeof...(SenderClosures) > 0)
             DAKING_ALWAYS_INLINE auto operator()(capture_t,
-                Emitter& emitter, const connection_signatures<Signal, SenderClosures>&... cons) const {
+                Emitter& emitter, const connection_signatures<Signal, SenderClosures, typename threading_of<Emitter>::type>&... cons) const {
                 return this->operator()(capture_t{}, &emitter, cons...);
             }
 
-            template <emittable Signal, typename...SenderClosures>
+            template <emittable Signal, typename Threading, typename...SenderClosures>
                 requires (sizeof...(SenderClosures) > 0)
-            DAKING_ALWAYS_INLINE void operator()(const Signal& signal, const connection_signatures<Signal, SenderClosures>&... cons) const {
+            DAKING_ALWAYS_INLINE void operator()(const Signal& signal, const connection_signatures<Signal, SenderClosures, Threading>&... cons) const {
                 EmitConnection<Signal>(signal, cons...);
             }
 
-            template <emittable Signal, typename...SenderClosures>
+            template <emittable Signal, typename Threading, typename...SenderClosures>
                 requires (sizeof...(SenderClosures) > 0)
-            DAKING_ALWAYS_INLINE auto operator()(const connection_signatures<Signal, SenderClosures>&... cons) const {
-                return connection_closure<Signal, SenderClosures...>({cons...});
+            DAKING_ALWAYS_INLINE auto operator()(const connection_signatures<Signal, SenderClosures, Threading>&... cons) const {
+                return connection_closure<Signal, Threading, SenderClosures...>({cons...});
             }
 
         private:
@@ -350,7 +954,7 @@ namespace daking {
             struct specific_emission_sender<signal<Args...>, SenderClosures...> {
                 using sender_concept = stdexec::sender_t;
                 template <typename SenderClosure>
-                using future_sender = std::decay_t<decltype(std::declval<exec::async_scope>().spawn_future(stdexec::just(std::declval<Args>()...) | std::declval<SenderClosure&&>()))>;
+                using future_sender = std::decay_t<decltype(std::declval<exec::async_scope>().spawn_future(stdexec::just(std::declval<Args>()...) | std::declval<SenderClosure&&>(), std::declval<capture_env>()))>;
                 using when_all_sender = std::decay_t<decltype(stdexec::when_all(std::declval<future_sender<SenderClosures>>()...))>;
                 using completion_signatures = stdexec::transform_completion_signatures<
                     stdexec::completion_signatures_of_t<when_all_sender>,
@@ -393,7 +997,7 @@ namespace daking {
             struct specific_emission_sender<signal<void>, Senders...> {
                 using sender_concept = stdexec::sender_t;
                 template <typename Sender>
-                using future_sender = std::decay_t<decltype(std::declval<exec::async_scope>().spawn_future(std::declval<Sender&&>()))>;
+                using future_sender = std::decay_t<decltype(std::declval<exec::async_scope>().spawn_future(std::declval<Sender&&>(), std::declval<capture_env>()))>;
                 using when_all_sender = std::decay_t<decltype(stdexec::when_all(std::declval<future_sender<Senders>>()...))>;
                 using completion_signatures = stdexec::transform_completion_signatures<
                     stdexec::completion_signatures_of_t<when_all_sender>,
@@ -446,28 +1050,35 @@ namespace daking {
                 exec::async_scope* scope_;
 
                 template <emittable Signal>
-                    requires std::derived_from<Emitter, emitter_unit<Signal>>
+                    requires unit_of<Emitter, Signal>
                 friend void operator>>(const Signal& signal, broadcast_emitter_closure&& self) {
-                    emit_t::Broadcast<Signal>(signal, self.emitter_, self.scope_);
+                    self.Emit(signal);
+                }
+
+                template <emittable Signal>
+                void Emit(const Signal& signal) {
+                    if (!emitter_->Is_closed()) [[likely]] {
+                        emit_t::Broadcast<Signal>(signal, emitter_, scope_);
+                    }
                 }
             };
 
-            template <emittable Signal, typename...SenderClosures>
+            template <emittable Signal, typename Threading, typename...SenderClosures>
             struct capture_emitter_closure {
-                emitter_unit<Signal>* emitter_;
-                exec::async_scope*    scope_;
-                std::tuple<connection_signatures<Signal, SenderClosures>...> cons_;
+                emitter_unit<Signal, Threading>* emitter_;
+                exec::async_scope*               scope_;
+                std::tuple<connection_signatures<Signal, SenderClosures, Threading>...> cons_;
 
                 friend auto operator>>(const Signal& signal, capture_emitter_closure&& self) {
-                    return std::apply([&](connection_signatures<Signal, SenderClosures>&&... cons) {
+                    return std::apply([&](connection_signatures<Signal, SenderClosures, Threading>&&... cons) {
                         return emit_t::Capture<Signal>(signal, self.emitter_, self.scope_, cons...);
                     }, std::move(self.cons_));
                 }
             };
 
-            template <emittable Signal, typename...SenderClosures>
+            template <emittable Signal, typename Threading, typename...SenderClosures>
             struct connection_closure {
-                std::tuple<connection_signatures<Signal, SenderClosures>...> cons_;
+                std::tuple<connection_signatures<Signal, SenderClosures, Threading>...> cons_;
 
                 friend auto operator>>(const Signal& signal, connection_closure&& self) {
                     return std::apply([&](auto&&...cons) { 
@@ -476,8 +1087,8 @@ namespace daking {
                 }
             };
 
-            template <emittable Signal>
-            DAKING_ALWAYS_INLINE static void Broadcast(const Signal& signal, emitter_unit<Signal>* emitter, exec::async_scope* scope) {
+            template <emittable Signal, typename Threading>
+            DAKING_ALWAYS_INLINE static void Broadcast(const Signal& signal, emitter_unit<Signal, Threading>* emitter, exec::async_scope* scope) {
                 if constexpr (Signal::is_void_signal) {
                     emitter->Broadcast(scope);
                 }
@@ -488,9 +1099,9 @@ namespace daking {
                 }
             }
 
-            template <emittable Signal, typename...SenderClosures>
+            template <emittable Signal, typename Threading, typename...SenderClosures>
             DAKING_ALWAYS_INLINE static auto Capture(const Signal& signal, 
-                emitter_unit<Signal>* emitter, exec::async_scope* scope, const connection_signatures<Signal, SenderClosures>&... cons) {
+                emitter_unit<Signal, Threading>* emitter, exec::async_scope* scope, const connection_signatures<Signal, SenderClosures, Threading>&... cons) {
                 
                 specific_emission_sender<signal_degradation_t<Signal>, SenderClosures...> sender;
 
@@ -508,13 +1119,13 @@ namespace daking {
                 return sender;
             }
 
-            template <emittable Signal, typename...SenderClosures>
-            DAKING_ALWAYS_INLINE static auto EmitConnection(const Signal& signal, const connection_signatures<Signal, SenderClosures>&... cons) {
+            template <emittable Signal, typename Threading, typename...SenderClosures>
+            DAKING_ALWAYS_INLINE static auto EmitConnection(const Signal& signal, const connection_signatures<Signal, SenderClosures, Threading>&... cons) {
                 specific_emission_sender<signal_degradation_t<Signal>, SenderClosures...> sender;
 
                 auto get_futures = [&]<std::size_t...Is>(std::index_sequence<Is...>, auto&...cons) {
                     auto get_future = [&]<std::size_t I>(auto& con) {
-                        auto slot = con.ptr_.lock();
+                        auto slot = con.Lock();
                         if (slot) {
                             if (slot->enabled_.load(std::memory_order_acquire)) {
                                 if constexpr (Signal::is_void_signal) {
@@ -540,247 +1151,3808 @@ namespace daking {
             }
         };
 
-        template <emittable Signal>
-        struct slot_base;
-
-        template <signal_arg...Args>
-        struct slot_base<signal<Args...>> {
-            slot_base()          = default;
-            virtual ~slot_base() = default;
+        struct timer_node {
+            timer_node()  = default;
+            ~timer_node() = default;
 
-            virtual void Invoke(exec::async_scope* scope, void* sender, const Args&...args) = 0;
+            timer_node(const timer_node&)            = delete;
+            timer_node& operator=(const timer_node&) = delete;
 
-            std::atomic_bool enabled_ = true;
+            void        (*fire_)(timer_node*) = nullptr;
+            timer_node*   prev_               = nullptr;
+            timer_node*   next_               = nullptr;
+            std::uint64_t expiry_             = 0;
         };
 
-        template <>
-        struct slot_base<signal<void>> {
-            slot_base()          = default;
-            virtual ~slot_base() = default;
+        // Hierarchical timing wheel: four levels of 256 buckets each, so schedule/cancel are O(1)
+        // and every tick touches one bucket (plus an occasional cascade of one upper bucket).
+        // Nodes are intrusive; callbacks run on the wheel thread and must not block, so they only do
+        // bookkeeping and hand user code to a scheduler (see timer_dispatch).
+        class timer_wheel {
+        public:
+            using clock = std::chrono::steady_clock;
 
-            virtual void Invoke(exec::async_scope* scope, void* sender) = 0;
+            explicit timer_wheel(clock::duration tick = std::chrono::milliseconds(1))
+                : tick_(tick), origin_(clock::now()) {
+                for (auto& level : wheel_) {
+                    for (auto& head : level) {
+                        head.prev_ = head.next_ = &head;
+                    }
+                }
+                thread_ = std::thread([this]() { Run(); });
+            }
 
-            std::atomic_bool enabled_ = true;
-        };
+            ~timer_wheel() {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    stop_ = true;
+                }
+                wakeup_.notify_all();
+                thread_.join();
+            }
 
-        template <emittable Signal, typename SenderClosure>
-        struct slot_impl;
+            timer_wheel(const timer_wheel&)            = delete;
+            timer_wheel& operator=(const timer_wheel&) = delete;
 
-        template <typename...Args, typename SenderClosure>
-            requires (!signal<Args...>::is_void_signal && std::copy_constructible<SenderClosure> 
-                && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>>)
-        struct slot_impl<signal<Args...>, SenderClosure> : slot_base<signal<Args...>> {
-            template <typename C>
-            slot_impl(C&& closure) : closure_(std::forward<C>(closure)) {}
-            ~slot_impl() = default;
-            
-            void Invoke(exec::async_scope* scope, void* sender, const Args&...args) override {
-                if (this->enabled_.load(std::memory_order_acquire)) {
-                    if (sender) {
-                        auto future_sender = scope->spawn_future(
-                            stdexec::just(args...) | closure_
-                        );
-                        auto target = (std::optional<decltype(future_sender)>*)sender;
-                        *target = std::move(future_sender);
-                    }
-                    else {
-                        scope->spawn(
-                            stdexec::just(args...) | closure_ | stdexec::then([](auto&&...) noexcept {}) 
-                        );
-                    }
+            // Never destroyed: emitters with static storage duration may cancel their timers after
+            // every function-local static has gone away.
+            static timer_wheel& shared() {
+                static timer_wheel* wheel = new timer_wheel;
+                return *wheel;
+            }
+
+            // (Re)arms the node, replacing any pending expiry.
+            void schedule(timer_node* node, clock::duration delay) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (node->next_) {
+                    Unlink(node);
+                }
+                if (count_ == 0) {
+                    current_ = std::max(current_, Elapsed());
+                }
+                auto deadline = clock::now() - origin_ + std::max(delay, clock::duration(1));
+                Insert(node, static_cast<std::uint64_t>((deadline + tick_ - clock::duration(1)) / tick_));
+                if (count_ == 1) {
+                    wakeup_.notify_one();
                 }
             }
 
-            SenderClosure closure_;
-        };
+            // Returns whether the node was pending. When called off the wheel thread it first waits
+            // for a running callback of this node (which may re-arm it), so the node may be destroyed afterwards.
+            bool cancel(timer_node* node) {
+                std::unique_lock<std::mutex> lock(mutex_);
+                if (std::this_thread::get_id() != thread_.get_id()) {
+                    idle_.wait(lock, [&]() { return running_ != node; });
+                }
+                if (!node->next_) {
+                    return false;
+                }
+                Unlink(node);
+                return true;
+            }
 
-        template <emittable Signal, stdexec::sender Sender>
-            requires (Signal::is_void_signal)
-        struct slot_impl<Signal, Sender> : slot_base<signal_degradation_t<Signal>> {
-            template <stdexec::sender S>
-            slot_impl(S&& sender) : sender_(std::forward<S>(sender)) {}
-            ~slot_impl() = default;
-            
-            void Invoke(exec::async_scope* scope, void* sender) override {
-                if (this->enabled_.load(std::memory_order_acquire)) {
-                    if (sender) {
-                        auto future_sender = scope->spawn_future(
-                            sender_
-                        );
-                        auto target = (std::optional<decltype(future_sender)>*)sender;
-                        *target = std::move(future_sender);
+        private:
+            static constexpr std::size_t   level_bits = 8;
+            static constexpr std::size_t   level_size = std::size_t(1) << level_bits;
+            static constexpr std::size_t   level_mask = level_size - 1;
+            static constexpr std::size_t   levels     = 4;
+            static constexpr std::uint64_t max_delta  = (std::uint64_t(1) << (level_bits * levels)) - 1;
+
+            std::uint64_t Elapsed() const noexcept {
+                return static_cast<std::uint64_t>((clock::now() - origin_) / tick_);
+            }
+
+            static void Link(timer_node* head, timer_node* node) noexcept {
+                node->prev_       = head->prev_;
+                node->next_       = head;
+                head->prev_->next_ = node;
+                head->prev_       = node;
+            }
+
+            void Unlink(timer_node* node) noexcept {
+                node->prev_->next_ = node->next_;
+                node->next_->prev_ = node->prev_;
+                node->prev_ = node->next_ = nullptr;
+                count_--;
+            }
+
+            // Expiries beyond the wheel's horizon are parked at the horizon and re-inserted when
+            // their bucket cascades, so long delays keep their deadline instead of firing early.
+            void Insert(timer_node* node, std::uint64_t expiry) noexcept {
+                node->expiry_ = std::max(expiry, current_);
+                std::uint64_t bucket = std::min(node->expiry_, current_ + max_delta);
+                std::uint64_t delta  = bucket - current_;
+                std::size_t   level  = 0;
+                while (level + 1 < levels && delta >= (std::uint64_t(1) << (level_bits * (level + 1)))) {
+                    level++;
+                }
+                Link(&wheel_[level][(bucket >> (level_bits * level)) & level_mask], node);
+                count_++;
+            }
+
+            void Advance(std::unique_lock<std::mutex>& lock) {
+                std::size_t index = current_ & level_mask;
+                for (std::size_t level = 1; index == 0 && level < levels; level++) {
+                    index = (current_ >> (level_bits * level)) & level_mask;
+                    timer_node* head = &wheel_[level][index];
+                    while (head->next_ != head) {
+                        timer_node* node = head->next_;
+                        Unlink(node);
+                        Insert(node, node->expiry_);
                     }
-                    else {
-                        scope->spawn(
-                            sender_ | stdexec::then([](auto&&...) noexcept {})
-                        );
+                }
+
+                timer_node* head = &wheel_[0][current_ & level_mask];
+                current_++;
+                while (head->next_ != head) {
+                    timer_node* node = head->next_;
+                    Unlink(node);
+                    running_ = node;
+                    lock.unlock();
+                    node->fire_(node);
+                    lock.lock();
+                    running_ = nullptr;
+                    idle_.notify_all();
+                }
+            }
+
+            void Run() {
+                std::unique_lock<std::mutex> lock(mutex_);
+                while (!stop_) {
+                    if (count_ == 0) {
+                        wakeup_.wait(lock, [this]() { return stop_ || count_ != 0; });
+                        continue;
+                    }
+                    std::uint64_t now = Elapsed();
+                    while (current_ <= now && count_ != 0) {
+                        Advance(lock);
+                    }
+                    if (count_ != 0) {
+                        wakeup_.wait_until(lock, origin_ + tick_ * current_);
                     }
                 }
             }
 
-            Sender sender_;
+            clock::duration         tick_;
+            clock::time_point       origin_;
+            std::uint64_t           current_ = 0;
+            std::size_t             count_   = 0;
+            timer_node*             running_ = nullptr;
+            bool                    stop_    = false;
+            timer_node              wheel_[levels][level_size];
+            std::mutex              mutex_;
+            std::condition_variable wakeup_;
+            std::condition_variable idle_;
+            std::thread             thread_;
         };
 
-        template <emittable Signal>
-        struct emitter_unit {
-            using slot = std::shared_ptr<slot_base<signal_degradation_t<Signal>>>;
+        // Where timer-driven slots run: a dedicated pool, so a slow slot never delays the wheel's ticks.
+        // Like the wheel it is never destroyed.
+        struct timer_dispatch {
+            static timer_dispatch& shared() {
+                static timer_dispatch* dispatch = new timer_dispatch;
+                return *dispatch;
+            }
 
-            emitter_unit()  = default;
-            ~emitter_unit() = default;
+            auto Scheduler() {
+                return pool_.get_scheduler();
+            }
 
-        private:
-            friend struct connect_t<Signal>;
-            friend struct disconnect_t<Signal>;
-            friend struct emit_t;
+            template <typename F>
+            void Post(F&& f) {
+                scope_.spawn(stdexec::schedule(pool_.get_scheduler()) | stdexec::then(std::forward<F>(f)));
+            }
 
-            template <typename SenderClosure>
-            std::weak_ptr<slot_base<signal_degradation_t<Signal>>> Register(SenderClosure&& sender_closure) {
-                slot new_slot = std::make_shared<slot_impl<signal_degradation_t<Signal>, 
-                    std::decay_t<SenderClosure>>>(std::forward<SenderClosure>(sender_closure));
+            exec::static_thread_pool pool_{1};
+            exec::async_scope        scope_;
+        };
 
-                std::shared_ptr<std::vector<slot>> old_slots = slots_.load(std::memory_order_acquire);
-                std::shared_ptr<std::vector<slot>> new_slots;
+        using timer_scheduler = decltype(std::declval<timer_dispatch&>().Scheduler());
 
-                do {
-                    if (old_slots) [[likely]] {
-                        new_slots = std::make_shared<std::vector<slot>>(*old_slots);
-                    } else {
-                        new_slots = std::make_shared<std::vector<slot>>();
+        // Leading-edge rate limit: at most one invocation per window. The window is reopened by the
+        // shared timer wheel, so the dispatch path costs one atomic exchange and never reads a clock.
+        struct throttle {
+            using connection_policy_tag = void;
+
+            template <typename Rep, typename Period>
+            explicit throttle(std::chrono::duration<Rep, Period> window)
+                : window_(std::chrono::duration_cast<timer_wheel::clock::duration>(window)) {}
+
+            template <typename Slot>
+            struct gate : timer_node {
+                gate(const throttle& policy) : window_(policy.window_) {
+                    this->fire_ = &Reopen;
+                }
+
+                ~gate() {
+                    Close();
+                }
+
+                template <typename...Args>
+                DAKING_ALWAYS_INLINE bool Admit(Slot&, exec::async_scope*, const Args&...) {
+                    if (!open_.load(std::memory_order_relaxed) || !open_.exchange(false, std::memory_order_acq_rel)) {
+                        return false;
                     }
-                    new_slots->push_back(new_slot);
-                } while (!slots_.compare_exchange_weak(
-                            old_slots, new_slots,
-                            std::memory_order_release, 
-                            std::memory_order_acquire
-                        ));
+                    timer_wheel::shared().schedule(this, window_);
+                    return true;
+                }
 
-                return new_slot;
-            }
+                void Close() noexcept {
+                    timer_wheel::shared().cancel(this);
+                }
 
-            bool Unregister(std::shared_ptr<slot_base<signal_degradation_t<Signal>>>&& ptr) {
-                std::shared_ptr<std::vector<slot>> old_slots = slots_.load(std::memory_order_acquire);
-                std::shared_ptr<std::vector<slot>> new_slots;
+            private:
+                static void Reopen(timer_node* node) {
+                    static_cast<gate*>(node)->open_.store(true, std::memory_order_release);
+                }
 
-                do {
-                    if (old_slots) [[likely]] {
-                        new_slots = std::make_shared<std::vector<slot>>(*old_slots);
-                    } else {
-                        new_slots = std::make_shared<std::vector<slot>>();
+                timer_wheel::clock::duration window_;
+                std::atomic_bool             open_ = true;
+            };
+
+        private:
+            timer_wheel::clock::duration window_;
+        };
+
+        // Trailing-edge coalescing: each emission overwrites the pending arguments and re-arms the
+        // timer; once the stream has been quiet the slot is spawned once, starting on the given
+        // scheduler (the shared timer_dispatch pool by default), never on the wheel thread.
+        template <typename Scheduler = timer_scheduler>
+        struct debounce {
+            using connection_policy_tag = void;
+
+            template <typename Rep, typename Period>
+            explicit debounce(std::chrono::duration<Rep, Period> quiet)
+                requires std::same_as<Scheduler, timer_scheduler>
+                : quiet_(std::chrono::duration_cast<timer_wheel::clock::duration>(quiet)), scheduler_(timer_dispatch::shared().Scheduler()) {}
+
+            template <typename Rep, typename Period>
+            debounce(std::chrono::duration<Rep, Period> quiet, Scheduler scheduler)
+                : quiet_(std::chrono::duration_cast<timer_wheel::clock::duration>(quiet)), scheduler_(std::move(scheduler)) {}
+
+            template <typename Slot>
+            struct gate : timer_node {
+                gate(const debounce& policy) : quiet_(policy.quiet_), scheduler_(policy.scheduler_) {
+                    this->fire_ = &Flush;
+                }
+
+                ~gate() {
+                    Close();
+                }
+
+                template <typename...Args>
+                bool Admit(Slot& slot, exec::async_scope* scope, const Args&...args) {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        pending_.emplace(args...);
+                        slot_  = &slot;
+                        scope_ = scope;
                     }
-                    auto it = std::remove(new_slots->begin(), new_slots->end(), ptr);
-                    if (it == new_slots->end()) {
-                        return false;
+                    timer_wheel::shared().schedule(this, quiet_);
+                    return false;
+                }
+
+                void Close() noexcept {
+                    timer_wheel::shared().cancel(this);
+                }
+
+            private:
+                static void Flush(timer_node* node) {
+                    auto self = static_cast<gate*>(node);
+                    std::optional<typename Slot::args_tuple> args;
+                    {
+                        std::lock_guard<std::mutex> lock(self->mutex_);
+                        args.swap(self->pending_);
                     }
-                    else {
-                        new_slots->erase(it);
+                    // A slot of a single-threaded emitter was checked when the emission arrived: its flag is plain.
+                    if (args && (std::same_as<typename Slot::threading, single_threaded> || self->slot_->enabled_.load(std::memory_order_acquire))) {
+                        std::apply([&](const auto&...args) { self->slot_->Spawn_on(self->scheduler_, self->scope_, args...); }, *args);
                     }
-                } while (!slots_.compare_exchange_weak(
-                            old_slots, new_slots,
-                            std::memory_order_release, 
-                            std::memory_order_acquire
-                        ));
+                }
 
-                return true;
+                timer_wheel::clock::duration            quiet_;
+                Scheduler                               scheduler_;
+                std::mutex                              mutex_;
+                std::optional<typename Slot::args_tuple> pending_;
+                Slot*                                   slot_  = nullptr;
+                exec::async_scope*                      scope_ = nullptr;
+            };
+
+        private:
+            timer_wheel::clock::duration quiet_;
+            Scheduler                    scheduler_;
+        };
+
+        template <typename Rep, typename Period>
+        debounce(std::chrono::duration<Rep, Period>) -> debounce<>;
+
+        template <typename Rep, typename Period, typename Scheduler>
+        debounce(std::chrono::duration<Rep, Period>, Scheduler) -> debounce<Scheduler>;
+
+        // Content filter evaluated on the emitting thread; a rejected emission costs one predicate call.
+        template <typename Predicate>
+        struct filter {
+            using connection_policy_tag = void;
+
+            template <typename Slot>
+            struct gate {
+                template <typename F>
+                gate(F&& policy) : predicate_(std::forward<F>(policy).predicate_) {}
+
+                template <typename...Args>
+                DAKING_ALWAYS_INLINE bool Admit(Slot&, exec::async_scope*, const Args&...args) {
+                    return static_cast<bool>(predicate_(args...));
+                }
+
+                void Close() noexcept {}
+
+                DAKING_NO_UNIQUE_ADDRESS Predicate predicate_;
+            };
+
+            DAKING_NO_UNIQUE_ADDRESS Predicate predicate_;
+        };
+
+        // Counts a member's in-flight emissions: raised on admission, lowered when the spawned work completes.
+        struct load_tracking {
+            using connection_policy_tag = void;
+
+            template <typename Slot>
+            struct gate {
+                gate(const load_tracking& policy) noexcept : load_(policy.load_) {}
+
+                template <typename...Args>
+                DAKING_ALWAYS_INLINE bool Admit(Slot&, exec::async_scope*, const Args&...) noexcept {
+                    load_->fetch_add(1, std::memory_order_relaxed);
+                    return true;
+                }
+
+                void Close() noexcept {}
+
+                // The counter is shared so that work outliving the group still has somewhere to report to.
+                template <stdexec::sender Sender>
+                auto Track(Sender&& sender) const {
+                    auto release = [load = load_]() noexcept { load->fetch_sub(1, std::memory_order_relaxed); };
+                    return std::forward<Sender>(sender)
+                        | stdexec::then([release](auto&&...) noexcept { release(); })
+                        | stdexec::upon_error([release](auto&&) noexcept { release(); })
+                        | stdexec::upon_stopped([release]() noexcept { release(); });
+                }
+
+                std::shared_ptr<std::atomic<std::size_t>> load_;
+            };
+
+            std::shared_ptr<std::atomic<std::size_t>> load_;
+        };
+
+        template <typename Gate>
+        concept completion_tracking = requires(const Gate& gate) { gate.Track(stdexec::just()); };
+
+        inline std::uint64_t mix64(std::uint64_t x) noexcept {
+            x ^= x >> 30;
+            x *= 0xbf58476d1ce4e5b9ull;
+            x ^= x >> 27;
+            x *= 0x94d049bb133111ebull;
+            x ^= x >> 31;
+            return x;
+        }
+
+        // Snapshot of a group's members; rebuilt by writers and read without locks by emitters.
+        template <typename Slot>
+        struct group_roster {
+            std::vector<Slot>                                      members_;
+            std::vector<std::shared_ptr<std::atomic<std::size_t>>> loads_;
+            std::vector<std::pair<std::uint64_t, std::size_t>>     ring_;
+        };
+
+        inline constexpr std::size_t no_member = static_cast<std::size_t>(-1);
+
+        // Consistent hashing on the I-th argument. Each member owns virtual_nodes points on the ring, seeded by
+        // its slot address, so a join or leave only moves the keys adjacent to that member's points.
+        template <std::size_t I>
+        struct partition_strategy {
+            static constexpr bool        tracks_load   = false;
+            static constexpr std::size_t virtual_nodes = 64;
+
+            template <typename Roster>
+            static void Build(Roster& roster) {
+                roster.ring_.clear();
+                roster.ring_.reserve(roster.members_.size() * virtual_nodes);
+                for (std::size_t i = 0; i < roster.members_.size(); i++) {
+                    auto seed = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(roster.members_[i].get()));
+                    for (std::size_t v = 0; v < virtual_nodes; v++) {
+                        roster.ring_.emplace_back(mix64(seed ^ mix64(v + 1)), i);
+                    }
+                }
+                std::sort(roster.ring_.begin(), roster.ring_.end());
             }
 
-            template <typename...Args>
-            void Broadcast(exec::async_scope* scope, const Args&... args) {
-                auto current_slots = slots_.load(std::memory_order_acquire);
+            template <typename Roster, typename...Args>
+            static std::size_t Pick(const Roster& roster, std::atomic<std::size_t>&, const Args&...args) {
+                using key = std::decay_t<std::tuple_element_t<I, std::tuple<Args...>>>;
+                std::uint64_t point = mix64(std::hash<key>{}(std::get<I>(std::forward_as_tuple(args...))));
 
-                if (current_slots) [[likely]] {
-                    for (auto& slot_ptr : *current_slots) {
-                        slot_ptr->Invoke(scope, nullptr, args...);
+                auto& ring = roster.ring_;
+                auto it = std::lower_bound(ring.begin(), ring.end(), point,
+                    [](const std::pair<std::uint64_t, std::size_t>& e, std::uint64_t p) { return e.first < p; });
+                // A disabled member hands its keys to the next member clockwise, as if it had left.
+                for (std::size_t n = 0; n < ring.size(); n++, ++it) {
+                    if (it == ring.end()) {
+                        it = ring.begin();
+                    }
+                    if (roster.members_[it->second]->enabled_.load(std::memory_order_acquire)) {
+                        return it->second;
                     }
                 }
+                return no_member;
             }
+        };
 
-            template <typename...SenderClosures>
-            void Check(const connection_signatures<Signal, SenderClosures>&... cons) {
-                auto current_slots = slots_.load(std::memory_order_acquire);
-                if (current_slots) [[likely]] {
-                    constexpr std::size_t size = []() consteval {
-                        std::size_t size = sizeof...(SenderClosures) - 1;
-                        for (int i = 1; i <= 32; i <<= 1)
-                            size |= size >> i;
-                        return size + 1;
-                    }();
-                    std::cout << "s:" << size << std::endl;
-                    void* hash_table[size] = {nullptr};
-                    std::hash<void*> hasher{};
+        struct round_robin_strategy {
+            static constexpr bool tracks_load = false;
 
-                    auto make_hash_table = [&](const auto& con) {
-                        auto ptr = con.ptr_.lock();
-                        if (!ptr) {
-                            throw std::runtime_error("Can't create sender: the connection has been closed.");
-                        }
-                        auto p = (void*)(ptr.get());
-                        auto hash_idx = hasher(p) & (size - 1);
-                        while (hash_table[hash_idx] != nullptr) {
-                            hash_idx = (hash_idx + 1) & (size - 1); 
-                        }
-                        hash_table[hash_idx] = p;
-                    };
-                    (make_hash_table(cons), ...);
+            template <typename Roster>
+            static void Build(Roster&) {}
 
-                    std::size_t count = 0;
-                    for (auto& slot_ptr : *current_slots) {
-                        auto p = (void*)(slot_ptr.get());
-                        auto hash_idx = hasher(p) & (size - 1);
-                        for (int i = 0; i < size && hash_table[hash_idx]; i++) {
-                            if (hash_table[hash_idx] == p) {
-                                count++;
+            template <typename Roster, typename...Args>
+            static std::size_t Pick(const Roster& roster, std::atomic<std::size_t>& cursor, const Args&...) {
+                std::size_t size  = roster.members_.size();
+                std::size_t start = cursor.fetch_add(1, std::memory_order_relaxed);
+                for (std::size_t n = 0; n < size; n++) {
+                    std::size_t i = (start + n) % size;
+                    if (roster.members_[i]->enabled_.load(std::memory_order_acquire)) {
+                        return i;
+                    }
+                }
+                return no_member;
+            }
+        };
+
+        // Fewest in-flight emissions wins; the rotating start spreads ties.
+        struct least_loaded_strategy {
+            static constexpr bool tracks_load = true;
+
+            template <typename Roster>
+            static void Build(Roster&) {}
+
+            template <typename Roster, typename...Args>
+            static std::size_t Pick(const Roster& roster, std::atomic<std::size_t>& cursor, const Args&...) {
+                std::size_t size  = roster.members_.size();
+                std::size_t start = cursor.fetch_add(1, std::memory_order_relaxed);
+                std::size_t best  = no_member;
+                std::size_t least = static_cast<std::size_t>(-1);
+                for (std::size_t n = 0; n < size; n++) {
+                    std::size_t i = (start + n) % size;
+                    if (roster.members_[i]->enabled_.load(std::memory_order_acquire)) {
+                        std::size_t load = roster.loads_[i]->load(std::memory_order_relaxed);
+                        if (load < least) {
+                            best  = i;
+                            least = load;
+                            if (load == 0) {
                                 break;
                             }
-                            else {
-                                hash_idx = (hash_idx + 1) & (size - 1); 
-                            }
                         }
                     }
-
-                    if (count == sizeof...(SenderClosures)) {
-                        return;
-                    }
                 }
-
-                throw std::runtime_error("Can't create sender: the connection is not connected to the emmiter or there are the same connections.");
+                return best;
             }
-
-            std::atomic<std::shared_ptr<std::vector<slot>>> slots_;
         };
 
-        struct emitter_scope {
-            emitter_scope() = default;
-            ~emitter_scope() {
-                stdexec::sync_wait(scope_.on_empty()); 
-            }
+        // Connections made with the same group name share the emissions of a signal: each one reaches one member.
+        template <typename Strategy>
+        struct consumer_group {
+            using connection_policy_tag = void;
+            using consumer_group_tag    = void;
+            using strategy              = Strategy;
 
-            exec::async_scope scope_;
+            std::string name_;
         };
 
-        template <emittable... Signals>
-        struct emitter_impl : emitter_unit<Signals>..., virtual emitter_scope {
-            friend struct emit_t;
+        template <std::size_t I>
+        struct partition_by_t {
+            consumer_group<partition_strategy<I>> operator()(std::string name) const {
+                return {std::move(name)};
+            }
+        };
 
-            static_assert(sizeof...(Signals) > 0, "Emitter should at least emit one kind of signal.");
+        struct round_robin_t {
+            consumer_group<round_robin_strategy> operator()(std::string name) const {
+                return {std::move(name)};
+            }
         };
-    }
 
-    using detail::signal;
-    using detail::emittable;
-    using detail::emitter;
-    using detail::connection;
+        struct least_loaded_t {
+            consumer_group<least_loaded_strategy> operator()(std::string name) const {
+                return {std::move(name)};
+            }
+        };
 
-    template <emittable Signal>
-    inline constexpr detail::connect_t<Signal> connect;
-    template <emittable Signal>
-    inline constexpr detail::disconnect_t<Signal> disconnect;
+        // State a slot shares with the work it spawned. Spawned work holds the slot through it, so a
+        // connection can still reach the slot after a disconnect for as long as that work runs.
+        // In-flight work is counted per epoch: a drain flips the epoch and waits for the old one to
+        // empty, and drains queue so that each also covers the epochs before it.
+        struct slot_control : std::enable_shared_from_this<slot_control> {
+            struct drain_waiter {
+                void (*complete_)(drain_waiter*) noexcept;
+                drain_waiter* next_  = nullptr;
+                unsigned      epoch_ = 0;
+            };
+
+            unsigned Enter() noexcept {
+                for (;;) {
+                    unsigned epoch = epoch_.load();
+                    flight_[epoch].fetch_add(1);
+                    // Counted in an epoch a drain has already flipped away from, this work might be
+                    // missed by that drain's check, so back out and count it in the new one.
+                    if (epoch_.load() == epoch) [[likely]] {
+                        return epoch;
+                    }
+                    Leave(epoch);
+                }
+            }
+
+            void Leave(unsigned epoch) noexcept {
+                if (flight_[epoch].fetch_sub(1) == 1 && epoch_.load() != epoch) {
+                    Drained();
+                }
+            }
+
+            void Drain(drain_waiter* waiter) noexcept {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    (tail_ ? tail_->next_ : head_) = waiter;
+                    tail_ = waiter;
+                    if (head_ == waiter) {
+                        Flip(waiter);
+                    }
+                }
+                Drained();
+            }
+
+            // Completes the first queued drain once its epoch is empty, then starts the next one.
+            void Drained() noexcept {
+                std::shared_ptr<slot_control> keep; // A completed drain may release the last reference
+                for (;;) {
+                    drain_waiter* done;
+                    {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        done = head_;
+                        if (!done || flight_[done->epoch_].load() != 0) {
+                            return;
+                        }
+                        head_ = done->next_;
+                        if (head_) {
+                            Flip(head_);
+                        }
+                        else {
+                            tail_ = nullptr;
+                        }
+                    }
+                    if (!keep) {
+                        keep = shared_from_this();
+                    }
+                    done->complete_(done);
+                }
+            }
+
+            void Flip(drain_waiter* waiter) noexcept {
+                waiter->epoch_ = epoch_.load(std::memory_order_relaxed);
+                epoch_.store(waiter->epoch_ ^ 1);
+            }
+
+            stdexec::inplace_stop_source stop_;
+            std::atomic<unsigned>        epoch_ = 0;
+            std::atomic<std::size_t>     flight_[2] = {0, 0};
+            std::mutex                   mutex_;
+            drain_waiter*                head_ = nullptr;
+            drain_waiter*                tail_ = nullptr;
+            // The resource of the unit that made the slot, offered to the work it spawns.
+            std::pmr::memory_resource*   resource_ = std::pmr::get_default_resource();
+            // The NUMA node the slot was placed on, or -1 for a slot placed nowhere.
+            int                          node_     = -1;
+            // Walks queued on the slot's node that will reach it, which a drain of the slot waits for first.
+            std::shared_ptr<slot_control> upstream_;
+        };
+
+        // The environment of spawned slot work: its stop token is the slot's, requested when the slot
+        // closes, and its allocator draws from the emitter's resource. The work counts as in flight for
+        // as long as its environment exists.
+        struct slot_env {
+            explicit slot_env(std::shared_ptr<slot_control>&& control) noexcept 
+                : control_(std::move(control)), epoch_(control_->Enter()) {}
+
+            slot_env(const slot_env& other) noexcept : control_(other.control_), epoch_(other.epoch_) {
+                control_->flight_[epoch_].fetch_add(1);
+            }
+
+            slot_env(slot_env&& other) noexcept : control_(std::move(other.control_)), epoch_(other.epoch_) {}
+
+            slot_env& operator=(const slot_env&) = delete;
+            slot_env& operator=(slot_env&&)      = delete;
+
+            ~slot_env() {
+                if (control_) {
+                    control_->Leave(epoch_);
+                }
+            }
+
+            stdexec::inplace_stop_token query(stdexec::get_stop_token_t) const noexcept {
+                return control_->stop_.get_token();
+            }
+
+            std::pmr::polymorphic_allocator<std::byte> query(stdexec::get_allocator_t) const noexcept {
+                return control_->resource_;
+            }
+
+            std::shared_ptr<slot_control> control_;
+            unsigned                      epoch_;
+        };
+
+        // The environment of work spawned for emit(con) and capture, which the caller awaits itself: the
+        // allocator only.
+        struct capture_env {
+            std::pmr::polymorphic_allocator<std::byte> query(stdexec::get_allocator_t) const noexcept {
+                return resource_;
+            }
+
+            std::pmr::memory_resource* resource_;
+        };
+
+        template <emittable Signal, typename Threading>
+        struct slot_base;
+
+        template <signal_arg...Args, typename Threading>
+        struct slot_base<signal<Args...>, Threading> : Threading::slot_state {
+            slot_base()          = default;
+            virtual ~slot_base() = default;
+
+            virtual void Invoke(exec::async_scope* scope, void* sender, const Args&...args) = 0;
+            virtual void Close() noexcept {}
+            virtual slot_control* Control() noexcept { return nullptr; }
+            // Takes the new closure from a pointer to the slot's own closure type.
+            virtual bool Replace(void*) { return false; }
+
+            // Composite slots (indices) own other slots that are not in the emitter's slot list.
+            virtual bool Remove_member(const std::shared_ptr<slot_base>&) { return false; }
+            virtual std::size_t Count_members(bool (*)(const void* table, const void* ptr), const void*) const { return 0; }
+
+            typename Threading::template atomic<bool> enabled_ = true;
+        };
+
+        template <typename Threading>
+        struct slot_base<signal<void>, Threading> : Threading::slot_state {
+            slot_base()          = default;
+            virtual ~slot_base() = default;
+
+            virtual void Invoke(exec::async_scope* scope, void* sender) = 0;
+            virtual void Close() noexcept {}
+            virtual slot_control* Control() noexcept { return nullptr; }
+            // Takes the new closure from a pointer to the slot's own closure type.
+            virtual bool Replace(void*) { return false; }
+
+            virtual bool Remove_member(const std::shared_ptr<slot_base>&) { return false; }
+            virtual std::size_t Count_members(bool (*)(const void* table, const void* ptr), const void*) const { return 0; }
+
+            typename Threading::template atomic<bool> enabled_ = true;
+        };
+
+        // A slot's closure, replaceable while emissions are in flight. Until the first replace it is read in
+        // place; after that each emission reads the latest published copy, and work already spawned keeps
+        // the copy it was spawned with.
+        template <typename Closure>
+        struct closure_cell {
+            template <typename C>
+            explicit closure_cell(C&& closure) : closure_(std::forward<C>(closure)) {}
+
+            template <typename F>
+            DAKING_ALWAYS_INLINE decltype(auto) Visit(F&& f) const {
+                if (!replaced_.load(std::memory_order_acquire)) [[likely]] {
+                    return f(closure_);
+                }
+                auto current = replacement_.load(std::memory_order_acquire);
+                return f(*current);
+            }
+
+            void Replace(Closure&& closure) {
+                replacement_.store(std::make_shared<const Closure>(std::move(closure)), std::memory_order_release);
+                replaced_.store(true, std::memory_order_release);
+            }
+
+            Closure                                     closure_;
+            std::atomic<std::shared_ptr<const Closure>> replacement_;
+            std::atomic_bool                            replaced_ = false;
+        };
+
+        template <emittable Signal, typename SenderClosure, typename Policy, typename Threading>
+        struct slot_impl;
+
+        template <typename...Args, typename SenderClosure, typename Policy, typename Threading>
+            requires (!signal<Args...>::is_void_signal && std::copy_constructible<SenderClosure> 
+                && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>>)
+        struct slot_impl<signal<Args...>, SenderClosure, Policy, Threading> : slot_base<signal<Args...>, Threading>, slot_control {
+            using args_tuple = std::tuple<Args...>;
+            using threading  = Threading;
+
+            template <typename P, typename C>
+            slot_impl(P&& policy, C&& closure) : closure_(std::forward<C>(closure)), gate_(std::forward<P>(policy)) {}
+            ~slot_impl() = default;
+            
+            void Invoke(exec::async_scope* scope, void* sender, const Args&...args) override {
+                if (this->enabled_.load(std::memory_order_acquire)) {
+                    if (sender) {
+                        auto future_sender = closure_.Visit([&](const SenderClosure& closure) {
+                            return scope->spawn_future(stdexec::just(args...) | closure, capture_env{this->resource_});
+                        });
+                        auto target = (std::optional<decltype(future_sender)>*)sender;
+                        *target = std::move(future_sender);
+                    }
+                    else if (gate_.Admit(*this, scope, args...)) {
+                        Spawn(scope, args...);
+                    }
+                }
+            }
+
+            void Close() noexcept override {
+                gate_.Close();
+                this->stop_.request_stop();
+                this->Detach();
+            }
+
+            slot_control* Control() noexcept override {
+                return this;
+            }
+
+            bool Replace(void* closure) override {
+                closure_.Replace(std::move(*static_cast<SenderClosure*>(closure)));
+                return true;
+            }
+
+            void Spawn(exec::async_scope* scope, const Args&...args) {
+                closure_.Visit([&](const SenderClosure& closure) {
+                    if constexpr (completion_tracking<decltype(gate_)>) {
+                        scope->spawn(
+                            gate_.Track(stdexec::just(args...) | closure) | stdexec::then([](auto&&...) noexcept {}),
+                            slot_env{this->shared_from_this()}
+                        );
+                    }
+                    else {
+                        scope->spawn(
+                            stdexec::just(args...) | closure | stdexec::then([](auto&&...) noexcept {}),
+                            slot_env{this->shared_from_this()}
+                        );
+                    }
+                });
+            }
+
+            template <typename Scheduler>
+            void Spawn_on(Scheduler& scheduler, exec::async_scope* scope, const Args&...args) {
+                closure_.Visit([&](const SenderClosure& closure) {
+                    scope->spawn(
+                        stdexec::starts_on(scheduler, stdexec::just(args...) | closure | stdexec::then([](auto&&...) noexcept {})),
+                        slot_env{this->shared_from_this()}
+                    );
+                });
+            }
+
+            closure_cell<SenderClosure> closure_;
+            DAKING_NO_UNIQUE_ADDRESS typename Policy::template gate<slot_impl> gate_;
+        };
+
+        template <emittable Signal, stdexec::sender Sender, typename Policy, typename Threading>
+            requires (Signal::is_void_signal)
+        struct slot_impl<Signal, Sender, Policy, Threading> : slot_base<signal_degradation_t<Signal>, Threading>, slot_control {
+            using args_tuple = std::tuple<>;
+            using threading  = Threading;
+
+            template <typename P, stdexec::sender S>
+            slot_impl(P&& policy, S&& sender) : sender_(std::forward<S>(sender)), gate_(std::forward<P>(policy)) {}
+            ~slot_impl() = default;
+            
+            void Invoke(exec::async_scope* scope, void* sender) override {
+                if (this->enabled_.load(std::memory_order_acquire)) {
+                    if (sender) {
+                        auto future_sender = sender_.Visit([&](const Sender& work) {
+                            return scope->spawn_future(work, capture_env{this->resource_});
+                        });
+                        auto target = (std::optional<decltype(future_sender)>*)sender;
+                        *target = std::move(future_sender);
+                    }
+                    else if (gate_.Admit(*this, scope)) {
+                        Spawn(scope);
+                    }
+                }
+            }
+
+            void Close() noexcept override {
+                gate_.Close();
+                this->stop_.request_stop();
+                this->Detach();
+            }
+
+            slot_control* Control() noexcept override {
+                return this;
+            }
+
+            bool Replace(void* sender) override {
+                sender_.Replace(std::move(*static_cast<Sender*>(sender)));
+                return true;
+            }
+
+            void Spawn(exec::async_scope* scope) {
+                sender_.Visit([&](const Sender& work) {
+                    if constexpr (completion_tracking<decltype(gate_)>) {
+                        scope->spawn(
+                            gate_.Track(work) | stdexec::then([](auto&&...) noexcept {}),
+                            slot_env{this->shared_from_this()}
+                        );
+                    }
+                    else {
+                        scope->spawn(
+                            work | stdexec::then([](auto&&...) noexcept {}),
+                            slot_env{this->shared_from_this()}
+                        );
+                    }
+                });
+            }
+
+            template <typename Scheduler>
+            void Spawn_on(Scheduler& scheduler, exec::async_scope* scope) {
+                sender_.Visit([&](const Sender& work) {
+                    scope->spawn(
+                        stdexec::starts_on(scheduler, work | stdexec::then([](auto&&...) noexcept {})),
+                        slot_env{this->shared_from_this()}
+                    );
+                });
+            }
+
+            closure_cell<Sender> sender_;
+            DAKING_NO_UNIQUE_ADDRESS typename Policy::template gate<slot_impl> gate_;
+        };
+
+        // Concurrent hash index from the I-th argument to slots. Readers take two atomic snapshot loads
+        // (table, bucket) and never lock; writers are serialized and copy only the bucket they touch,
+        // except when the table doubles.
+        template <typename...Args, std::size_t I, typename Key, typename Threading>
+        struct slot_index<signal<Args...>, I, Key, Threading> : slot_base<signal<Args...>, Threading> {
+            using slot = std::shared_ptr<slot_base<signal<Args...>, Threading>>;
+
+            struct entry {
+                std::size_t hash_;
+                Key         key_;
+                slot        slot_;
+            };
+
+            using chain = std::vector<entry>;
+
+            struct table {
+                explicit table(std::size_t size)
+                    : buckets_(new std::atomic<std::shared_ptr<const chain>>[size]), mask_(size - 1) {}
+
+                std::unique_ptr<std::atomic<std::shared_ptr<const chain>>[]> buckets_;
+                std::size_t                                                  mask_;
+            };
+
+            void Invoke(exec::async_scope* scope, void* sender, const Args&...args) override {
+                auto current = table_.load(std::memory_order_acquire);
+                if (current) [[likely]] {
+                    const auto& key  = std::get<I>(std::forward_as_tuple(args...));
+                    std::size_t hash = std::hash<Key>{}(key);
+                    auto bucket = current->buckets_[hash & current->mask_].load(std::memory_order_acquire);
+                    if (bucket) {
+                        for (auto& e : *bucket) {
+                            if (e.hash_ == hash && e.key_ == key) {
+                                e.slot_->Invoke(scope, sender, args...);
+                            }
+                        }
+                    }
+                }
+            }
+
+            void Close() noexcept override {
+                For_each([](const slot& slot_ptr) { slot_ptr->Close(); });
+            }
+
+            void Insert(Key&& key, const slot& member) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                auto current = table_.load(std::memory_order_acquire);
+                if (!current) {
+                    current = std::make_shared<table>(16);
+                    table_.store(current, std::memory_order_release);
+                }
+                else if (size_ > current->mask_) {
+                    current = Grow(*current);
+                    table_.store(current, std::memory_order_release);
+                }
+
+                std::size_t hash = std::hash<Key>{}(key);
+                auto& bucket = current->buckets_[hash & current->mask_];
+                auto old_chain = bucket.load(std::memory_order_acquire);
+                auto new_chain = old_chain ? std::make_shared<chain>(*old_chain) : std::make_shared<chain>();
+                new_chain->push_back({hash, std::move(key), member});
+                bucket.store(std::move(new_chain), std::memory_order_release);
+                hashes_.emplace(member.get(), hash);
+                size_++;
+            }
+
+            // The key hash recorded at connect time leads straight to the member's bucket.
+            bool Remove_member(const slot& member) override {
+                std::lock_guard<std::mutex> lock(mutex_);
+                auto hash = hashes_.find(member.get());
+                if (hash == hashes_.end()) {
+                    return false;
+                }
+                auto current   = table_.load(std::memory_order_acquire);
+                auto& bucket   = current->buckets_[hash->second & current->mask_];
+                auto old_chain = bucket.load(std::memory_order_acquire);
+                hashes_.erase(hash);
+
+                auto found = std::find_if(old_chain->begin(), old_chain->end(), [&](const entry& e) { return e.slot_ == member; });
+                auto new_chain = std::make_shared<chain>(*old_chain);
+                new_chain->erase(new_chain->begin() + (found - old_chain->begin()));
+                bucket.store(new_chain->empty() ? nullptr : std::move(new_chain), std::memory_order_release);
+                size_--;
+                return true;
+            }
+
+            std::size_t Count_members(bool (*contains)(const void* table, const void* ptr), const void* table) const override {
+                std::size_t count = 0;
+                For_each([&](const slot& slot_ptr) { count += contains(table, slot_ptr.get()); });
+                return count;
+            }
+
+        private:
+            template <typename F>
+            void For_each(F&& f) const {
+                auto current = table_.load(std::memory_order_acquire);
+                if (current) {
+                    for (std::size_t i = 0; i <= current->mask_; i++) {
+                        if (auto bucket = current->buckets_[i].load(std::memory_order_acquire)) {
+                            for (auto& e : *bucket) {
+                                f(e.slot_);
+                            }
+                        }
+                    }
+                }
+            }
+
+            static std::shared_ptr<table> Grow(const table& old_table) {
+                std::size_t size = (old_table.mask_ + 1) * 2;
+                std::vector<chain> chains(size);
+                for (std::size_t i = 0; i <= old_table.mask_; i++) {
+                    if (auto bucket = old_table.buckets_[i].load(std::memory_order_acquire)) {
+                        for (auto& e : *bucket) {
+                            chains[e.hash_ & (size - 1)].push_back(e);
+                        }
+                    }
+                }
+                auto new_table = std::make_shared<table>(size);
+                for (std::size_t i = 0; i < size; i++) {
+                    if (!chains[i].empty()) {
+                        new_table->buckets_[i].store(std::make_shared<chain>(std::move(chains[i])), std::memory_order_relaxed);
+                    }
+                }
+                return new_table;
+            }
+
+            std::atomic<std::shared_ptr<table>>          table_;
+            std::mutex                                   mutex_;
+            std::unordered_map<const void*, std::size_t> hashes_; // member -> key hash, guarded by mutex_
+            std::size_t                                  size_ = 0;
+        };
+
+        // Membership of a consumer group. Emitters pick one member from an immutable roster snapshot;
+        // joins and leaves copy the roster under the writer mutex and rebuild the strategy's routing data.
+        template <typename Slot, typename Strategy>
+        struct group_core {
+            using roster = group_roster<Slot>;
+
+            explicit group_core(std::string name) : name_(std::move(name)) {}
+
+            template <typename...Args>
+            DAKING_ALWAYS_INLINE void Dispatch(exec::async_scope* scope, void* sender, const Args&...args) {
+                auto current = roster_.load(std::memory_order_acquire);
+                if (current && !current->members_.empty()) [[likely]] {
+                    std::size_t chosen = Strategy::Pick(*current, cursor_, args...);
+                    if (chosen != no_member) {
+                        current->members_[chosen]->Invoke(scope, sender, args...);
+                    }
+                }
+            }
+
+            void Join(const Slot& member, std::shared_ptr<std::atomic<std::size_t>>&& load) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                auto old_roster = roster_.load(std::memory_order_acquire);
+                auto new_roster = old_roster ? std::make_shared<roster>(*old_roster) : std::make_shared<roster>();
+                new_roster->members_.push_back(member);
+                new_roster->loads_.push_back(std::move(load));
+                Strategy::Build(*new_roster);
+                roster_.store(std::move(new_roster), std::memory_order_release);
+            }
+
+            bool Leave(const Slot& member) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                auto old_roster = roster_.load(std::memory_order_acquire);
+                if (!old_roster) {
+                    return false;
+                }
+                auto found = std::find(old_roster->members_.begin(), old_roster->members_.end(), member);
+                if (found == old_roster->members_.end()) {
+                    return false;
+                }
+                auto new_roster = std::make_shared<roster>(*old_roster);
+                auto offset = found - old_roster->members_.begin();
+                new_roster->members_.erase(new_roster->members_.begin() + offset);
+                new_roster->loads_.erase(new_roster->loads_.begin() + offset);
+                Strategy::Build(*new_roster);
+                roster_.store(std::move(new_roster), std::memory_order_release);
+                return true;
+            }
+
+            // Capturing a member would still broadcast to the rest of the group, which then hands the
+            // emission to another member; the contract of a group is exactly one delivery.
+            std::size_t Reject_capture(bool (*contains)(const void* table, const void* ptr), const void* table) const {
+                this->For_each([&](const Slot& member) {
+                    if (contains(table, member.get())) {
+                        throw std::runtime_error("Can't create sender: the connection is a member of consumer group '" + name_ + "'.");
+                    }
+                });
+                return 0;
+            }
+
+            template <typename F>
+            void For_each(F&& f) const {
+                if (auto current = roster_.load(std::memory_order_acquire)) {
+                    for (auto& member : current->members_) {
+                        f(member);
+                    }
+                }
+            }
+
+            const std::string                    name_;
+            std::mutex                           mutex_;
+            std::atomic<std::shared_ptr<roster>> roster_;
+            std::atomic<std::size_t>             cursor_ = 0;
+        };
+
+        template <typename...Args, typename Strategy, typename Threading>
+        struct slot_group<signal<Args...>, Strategy, Threading> 
+            : slot_base<signal<Args...>, Threading>, group_core<std::shared_ptr<slot_base<signal<Args...>, Threading>>, Strategy> {
+            using slot = std::shared_ptr<slot_base<signal<Args...>, Threading>>;
+            using group_core<slot, Strategy>::group_core;
+
+            void Invoke(exec::async_scope* scope, void* sender, const Args&...args) override {
+                this->Dispatch(scope, sender, args...);
+            }
+
+            void Close() noexcept override {
+                this->For_each([](const slot& member) { member->Close(); });
+            }
+
+            bool Remove_member(const slot& member) override {
+                return this->Leave(member);
+            }
+
+            std::size_t Count_members(bool (*contains)(const void* table, const void* ptr), const void* table) const override {
+                return this->Reject_capture(contains, table);
+            }
+        };
+
+        template <typename Strategy, typename Threading>
+        struct slot_group<signal<void>, Strategy, Threading> 
+            : slot_base<signal<void>, Threading>, group_core<std::shared_ptr<slot_base<signal<void>, Threading>>, Strategy> {
+            using slot = std::shared_ptr<slot_base<signal<void>, Threading>>;
+            using group_core<slot, Strategy>::group_core;
+
+            void Invoke(exec::async_scope* scope, void* sender) override {
+                this->Dispatch(scope, sender);
+            }
+
+            void Close() noexcept override {
+                this->For_each([](const slot& member) { member->Close(); });
+            }
+
+            bool Remove_member(const slot& member) override {
+                return this->Leave(member);
+            }
+
+            std::size_t Count_members(bool (*contains)(const void* table, const void* ptr), const void* table) const override {
+                return this->Reject_capture(contains, table);
+            }
+        };
+
+        // The nodes of a machine and the CPUs of each. system() reads them from Linux sysfs, with no need for
+        // libnuma, and falls back to one node holding every CPU. simulated() makes a topology up, so that node
+        // placement and dispatch can be exercised on a single-node machine.
+        class numa_topology {
+        public:
+            explicit numa_topology(std::vector<std::vector<int>> cpus) : cpus_(std::move(cpus)) {
+                if (cpus_.empty()) {
+                    throw std::runtime_error("Can't make a NUMA topology without nodes.");
+                }
+            }
+
+            static numa_topology system() {
+                std::vector<std::vector<int>> cpus;
+                std::ifstream online("/sys/devices/system/node/online");
+                std::string   nodes;
+                if (online >> nodes) {
+                    for (int node : Parse(nodes)) {
+                        std::ifstream list("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+                        std::string   ranges;
+                        cpus.resize(std::max(cpus.size(), static_cast<std::size_t>(node) + 1));
+                        if (list >> ranges) {
+                            cpus[node] = Parse(ranges);
+                        }
+                    }
+                }
+                if (cpus.empty()) {
+                    cpus.emplace_back();
+                    for (unsigned cpu = 0; cpu < std::max(1u, std::thread::hardware_concurrency()); cpu++) {
+                        cpus[0].push_back(static_cast<int>(cpu));
+                    }
+                }
+                return numa_topology(std::move(cpus));
+            }
+
+            // nodes nodes of cpus_per_node CPUs each, numbered from 0. CPUs the machine does not have are
+            // never pinned to.
+            static numa_topology simulated(std::size_t nodes, std::size_t cpus_per_node) {
+                std::vector<std::vector<int>> cpus(nodes);
+                for (std::size_t node = 0; node < nodes; node++) {
+                    for (std::size_t cpu = 0; cpu < cpus_per_node; cpu++) {
+                        cpus[node].push_back(static_cast<int>(node * cpus_per_node + cpu));
+                    }
+                }
+                return numa_topology(std::move(cpus));
+            }
+
+            std::size_t nodes() const noexcept {
+                return cpus_.size();
+            }
+
+            const std::vector<int>& cpus(std::size_t node) const {
+                return cpus_.at(node);
+            }
+
+            // The node owning cpu, or -1.
+            int node_of(int cpu) const noexcept {
+                for (std::size_t node = 0; node < cpus_.size(); node++) {
+                    if (std::find(cpus_[node].begin(), cpus_[node].end(), cpu) != cpus_[node].end()) {
+                        return static_cast<int>(node);
+                    }
+                }
+                return -1;
+            }
+
+        private:
+            // Reads a sysfs list such as "0-3,8-11".
+            static std::vector<int> Parse(const std::string& ranges) {
+                std::vector<int> values;
+                for (std::size_t i = 0; i < ranges.size();) {
+                    std::size_t end  = std::min(ranges.find(',', i), ranges.size());
+                    std::size_t dash = ranges.find('-', i);
+                    int first = std::stoi(ranges.substr(i, std::min(dash, end) - i));
+                    int last  = dash < end ? std::stoi(ranges.substr(dash + 1, end - dash - 1)) : first;
+                    for (int value = first; value <= last; value++) {
+                        values.push_back(value);
+                    }
+                    i = end + 1;
+                }
+                return values;
+            }
+
+            std::vector<std::vector<int>> cpus_;
+        };
+
+        class numa_domain;
+
+        // Set on the dispatch threads of a domain, which always know their node.
+        inline thread_local const numa_domain* current_domain      = nullptr;
+        inline thread_local int                current_domain_node = -1;
+
+        // Dispatch threads for each node of a topology, pinned to the CPUs of their node where those exist,
+        // and the memory resource slots placed on each node are allocated from. A domain must outlive the
+        // emitters with slots placed in it.
+        class numa_domain {
+        public:
+            explicit numa_domain(numa_topology topology = numa_topology::system(), std::size_t threads_per_node = 1)
+                : topology_(std::move(topology)), resources_(topology_.nodes(), nullptr) {
+                for (std::size_t node = 0; node < topology_.nodes(); node++) {
+                    queues_.push_back(std::make_unique<node_queue>());
+                }
+                for (std::size_t node = 0; node < topology_.nodes(); node++) {
+                    for (std::size_t i = 0; i < std::max<std::size_t>(threads_per_node, 1); i++) {
+                        queues_[node]->threads_.emplace_back(&numa_domain::Run, this, static_cast<int>(node));
+                    }
+                }
+            }
+
+            // Runs what was already posted, then joins the dispatch threads.
+            ~numa_domain() {
+                for (auto& queue : queues_) {
+                    {
+                        std::lock_guard<std::mutex> lock(queue->mutex_);
+                        queue->stop_ = true;
+                    }
+                    queue->wakeup_.notify_all();
+                }
+                for (auto& queue : queues_) {
+                    for (auto& thread : queue->threads_) {
+                        thread.join();
+                    }
+                }
+            }
+
+            numa_domain(const numa_domain&)            = delete;
+            numa_domain& operator=(const numa_domain&) = delete;
+
+            const numa_topology& topology() const noexcept {
+                return topology_;
+            }
+
+            std::size_t nodes() const noexcept {
+                return topology_.nodes();
+            }
+
+            // The node of the calling thread: its own on a dispatch thread of this domain, otherwise the node
+            // of the CPU it runs on, and 0 where that is unknown.
+            int this_node() const noexcept {
+                if (current_domain == this) {
+                    return current_domain_node;
+                }
+#if defined(__linux__)
+                int node = topology_.node_of(::sched_getcpu());
+                return node < 0 ? 0 : node;
+#else
+                return 0;
+#endif
+            }
+
+            // Slots placed on node are allocated from resource, a huge_page_arena bound to the node for
+            // instance, instead of their emitter's. It must outlive those slots and their work.
+            void set_resource(int node, std::pmr::memory_resource* resource) {
+                resources_.at(node) = resource;
+            }
+
+            std::pmr::memory_resource* resource(int node) const noexcept {
+                return resources_[node];
+            }
+
+            class scheduler;
+
+            // A scheduler whose work starts on a dispatch thread of node.
+            scheduler get_scheduler(int node) noexcept;
+
+            // Runs f on a dispatch thread of node.
+            template <typename F>
+            void post(int node, F&& f) {
+                struct task : node_task {
+                    static void Run(node_task* base) {
+                        std::unique_ptr<task> self(static_cast<task*>(base));
+                        self->f_();
+                    }
+
+                    std::decay_t<F> f_;
+                };
+                Post(node, new task{{&task::Run}, std::forward<F>(f)});
+            }
+
+        private:
+            struct node_task {
+                void (*run_)(node_task*);
+                node_task* next_ = nullptr;
+            };
+
+            struct node_queue {
+                std::mutex               mutex_;
+                std::condition_variable  wakeup_;
+                node_task*               head_ = nullptr;
+                node_task*               tail_ = nullptr;
+                bool                     stop_ = false;
+                std::vector<std::thread> threads_;
+            };
+
+            void Post(int node, node_task* task) {
+                node_queue& queue = *queues_.at(node);
+                {
+                    std::lock_guard<std::mutex> lock(queue.mutex_);
+                    (queue.tail_ ? queue.tail_->next_ : queue.head_) = task;
+                    queue.tail_ = task;
+                }
+                queue.wakeup_.notify_one();
+            }
+
+            void Run(int node) {
+                current_domain      = this;
+                current_domain_node = node;
+                Pin(node);
+
+                node_queue& queue = *queues_[node];
+                std::unique_lock<std::mutex> lock(queue.mutex_);
+                for (;;) {
+                    queue.wakeup_.wait(lock, [&]() { return queue.stop_ || queue.head_; });
+                    node_task* task = queue.head_;
+                    if (!task) {
+                        return;
+                    }
+                    queue.head_ = task->next_;
+                    if (!queue.head_) {
+                        queue.tail_ = nullptr;
+                    }
+                    lock.unlock();
+                    task->run_(task);
+                    lock.lock();
+                }
+            }
+
+            // Best effort: CPUs a simulated topology makes up leave the thread where the scheduler puts it.
+            void Pin(int node) const noexcept {
+#if defined(__linux__)
+                cpu_set_t set;
+                CPU_ZERO(&set);
+                bool any = false;
+                for (int cpu : topology_.cpus(node)) {
+                    if (cpu >= 0 && cpu < CPU_SETSIZE) {
+                        CPU_SET(cpu, &set);
+                        any = true;
+                    }
+                }
+                if (any) {
+                    ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set);
+                }
+#endif
+            }
+
+            numa_topology                            topology_;
+            std::vector<std::pmr::memory_resource*>  resources_;
+            std::vector<std::unique_ptr<node_queue>> queues_;
+        };
+
+        // Starting the schedule operation queues it on its node; the dispatch thread that takes it completes it.
+        // A domain runs everything queued before its threads exit, so the operation always completes.
+        class numa_domain::scheduler {
+        public:
+            template <typename Receiver>
+            struct operation : node_task {
+                template <stdexec::receiver Rcvr>
+                operation(numa_domain* domain, int node, Rcvr&& rcvr)
+                    : node_task{&Run}, domain_(domain), node_(node), rcvr_(std::forward<Rcvr>(rcvr)) {}
+
+                operation(const operation&)            = delete;
+                operation& operator=(const operation&) = delete;
+
+                friend void tag_invoke(stdexec::start_t, operation& self) noexcept {
+                    Start(self);
+                }
+
+            private:
+                static void Start(operation& self) noexcept {
+                    self.domain_->Post(self.node_, &self);
+                }
+
+                static void Run(node_task* base) {
+                    stdexec::set_value(std::move(static_cast<operation*>(base)->rcvr_));
+                }
+
+                numa_domain* domain_;
+                int          node_;
+                Receiver     rcvr_;
+            };
+
+            struct env {
+                scheduler query(stdexec::get_completion_scheduler_t<stdexec::set_value_t>) const noexcept {
+                    return {domain_, node_};
+                }
+
+                numa_domain* domain_;
+                int          node_;
+            };
+
+            struct sender {
+                using sender_concept        = stdexec::sender_t;
+                using completion_signatures = stdexec::completion_signatures<stdexec::set_value_t()>;
+
+                template <stdexec::receiver Receiver>
+                friend auto tag_invoke(stdexec::connect_t, sender self, Receiver&& rcvr) {
+                    return operation<std::decay_t<Receiver>>(self.domain_, self.node_, std::forward<Receiver>(rcvr));
+                }
+
+                friend env tag_invoke(stdexec::get_env_t, const sender& self) noexcept {
+                    return {self.domain_, self.node_};
+                }
+
+                numa_domain* domain_;
+                int          node_;
+            };
+
+            friend sender tag_invoke(stdexec::schedule_t, const scheduler& self) noexcept {
+                return {self.domain_, self.node_};
+            }
+
+            bool operator==(const scheduler&) const noexcept = default;
+
+            int node() const noexcept {
+                return node_;
+            }
+
+        private:
+            friend class numa_domain;
+
+            scheduler(numa_domain* domain, int node) noexcept : domain_(domain), node_(node) {}
+
+            numa_domain* domain_;
+            int          node_;
+        };
+
+        inline numa_domain::scheduler numa_domain::get_scheduler(int node) noexcept {
+            return {this, node};
+        }
+
+        // Places a connection's slot in the partition of a NUMA node: the node given, typically that of the
+        // scheduler its closure continues on, or else the node of the thread making the connection.
+        struct numa_local {
+            using connection_policy_tag = void;
+            using numa_placement_tag    = void;
+
+            explicit numa_local(numa_domain& domain) noexcept : domain_(&domain), node_(domain.this_node()) {}
+
+            numa_local(numa_domain& domain, int node) : domain_(&domain), node_(node) {
+                if (node < 0 || static_cast<std::size_t>(node) >= domain.nodes()) {
+                    throw std::runtime_error("Can't place the slot: the domain has no such NUMA node.");
+                }
+            }
+
+            numa_domain* domain_;
+            int          node_;
+        };
+
+        // The slots of an emitter placed in one domain, partitioned by node. A broadcast walks the partition of
+        // the emitting thread's node in place, and spawns a walk of each other non-empty partition, with a copy of
+        // the arguments, into the emitter's scope on a dispatch thread of that node, so every slot is read and
+        // starts its work on its own node. Partitions are copied on write under the writer mutex. A queued walk
+        // is counted in the scope, so closing and destroying the emitter wait for it, and in a per-node control
+        // its members point to, so a drain of one of them waits for it too.
+        template <typename Slot>
+        struct partition_core {
+            using partition = std::vector<Slot>;
+            using table     = std::vector<std::shared_ptr<const partition>>;
+
+            explicit partition_core(numa_domain& domain) : domain_(&domain) {
+                for (std::size_t node = 0; node < domain.nodes(); node++) {
+                    auto& walks = walks_.emplace_back(std::make_shared<slot_control>());
+                    if (auto resource = domain.resource(static_cast<int>(node))) {
+                        walks->resource_ = resource;
+                    }
+                    walks->node_ = static_cast<int>(node);
+                }
+            }
+
+            template <typename...Args>
+            void Dispatch(exec::async_scope* scope, void* sender, const Args&...args) {
+                auto current = table_.load(std::memory_order_acquire);
+                if (!current) [[unlikely]] {
+                    return;
+                }
+                int here = domain_->this_node();
+                for (std::size_t node = 0; node < current->size(); node++) {
+                    const auto& members = (*current)[node];
+                    if (!members) {
+                        continue;
+                    }
+                    if (sender || static_cast<int>(node) == here) {
+                        for (auto& member : *members) {
+                            member->Invoke(scope, sender, args...);
+                        }
+                    }
+                    else {
+                        scope->spawn(
+                            stdexec::starts_on(domain_->get_scheduler(static_cast<int>(node)), stdexec::just() | stdexec::then([members, scope, args...]() {
+                                for (auto& member : *members) {
+                                    member->Invoke(scope, nullptr, args...);
+                                }
+                            })),
+                            slot_env{std::shared_ptr<slot_control>(walks_[node])}
+                        );
+                    }
+                }
+            }
+
+            void Shut() noexcept {
+                For_each([](const Slot& member) { member->Close(); });
+            }
+
+            void Join(int node, const Slot& member) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                auto old_table = table_.load(std::memory_order_acquire);
+                auto new_table = old_table ? std::make_shared<table>(*old_table) : std::make_shared<table>(domain_->nodes());
+                auto& slots = (*new_table)[node];
+                auto grown  = slots ? std::make_shared<partition>(*slots) : std::make_shared<partition>();
+                grown->push_back(member);
+                member->Control()->upstream_ = walks_[node];
+                slots = std::move(grown);
+                table_.store(std::move(new_table), std::memory_order_release);
+            }
+
+            bool Leave(const Slot& member) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                auto old_table = table_.load(std::memory_order_acquire);
+                if (!old_table) {
+                    return false;
+                }
+                for (std::size_t node = 0; node < old_table->size(); node++) {
+                    const auto& slots = (*old_table)[node];
+                    auto found = slots ? std::find(slots->begin(), slots->end(), member) : typename partition::const_iterator{};
+                    if (slots && found != slots->end()) {
+                        auto new_table = std::make_shared<table>(*old_table);
+                        auto shrunk    = std::make_shared<partition>(*slots);
+                        shrunk->erase(shrunk->begin() + (found - slots->begin()));
+                        (*new_table)[node] = shrunk->empty() ? nullptr : std::move(shrunk);
+                        table_.store(std::move(new_table), std::memory_order_release);
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            std::size_t Count(bool (*contains)(const void* table, const void* ptr), const void* table) const {
+                std::size_t count = 0;
+                For_each([&](const Slot& member) { count += contains(table, member.get()); });
+                return count;
+            }
+
+            template <typename F>
+            void For_each(F&& f) const {
+                if (auto current = table_.load(std::memory_order_acquire)) {
+                    for (auto& members : *current) {
+                        if (members) {
+                            for (auto& member : *members) {
+                                f(member);
+                            }
+                        }
+                    }
+                }
+            }
+
+            numa_domain* const                         domain_;
+            std::vector<std::shared_ptr<slot_control>> walks_;
+            std::mutex                                 mutex_;
+            std::atomic<std::shared_ptr<table>>        table_;
+        };
+
+        template <typename...Args>
+        struct slot_partitions<signal<Args...>>
+            : slot_base<signal<Args...>>, partition_core<std::shared_ptr<slot_base<signal<Args...>>>> {
+            using slot = std::shared_ptr<slot_base<signal<Args...>>>;
+            using partition_core<slot>::partition_core;
+
+            void Invoke(exec::async_scope* scope, void* sender, const Args&...args) override {
+                this->Dispatch(scope, sender, args...);
+            }
+
+            void Close() noexcept override {
+                this->Shut();
+            }
+
+            bool Remove_member(const slot& member) override {
+                return this->Leave(member);
+            }
+
+            std::size_t Count_members(bool (*contains)(const void* table, const void* ptr), const void* table) const override {
+                return this->Count(contains, table);
+            }
+        };
+
+        template <>
+        struct slot_partitions<signal<void>>
+            : slot_base<signal<void>>, partition_core<std::shared_ptr<slot_base<signal<void>>>> {
+            using slot = std::shared_ptr<slot_base<signal<void>>>;
+            using partition_core<slot>::partition_core;
+
+            void Invoke(exec::async_scope* scope, void* sender) override {
+                this->Dispatch(scope, sender);
+            }
+
+            void Close() noexcept override {
+                this->Shut();
+            }
+
+            bool Remove_member(const slot& member) override {
+                return this->Leave(member);
+            }
+
+            std::size_t Count_members(bool (*contains)(const void* table, const void* ptr), const void* table) const override {
+                return this->Count(contains, table);
+            }
+        };
+
+        // Constructs a slot on resource but leaves its shared_ptr control block on the global heap. Handles keep
+        // only the control block alive, so a handle that outlives the resource never reaches back into it.
+        template <typename Impl, typename...Ts>
+        std::shared_ptr<Impl> make_slot_on(std::pmr::memory_resource* resource, Ts&&...args) {
+            void* storage = resource->allocate(sizeof(Impl), alignof(Impl));
+            Impl* impl;
+            try {
+                impl = std::construct_at(static_cast<Impl*>(storage), std::forward<Ts>(args)...);
+            }
+            catch (...) {
+                resource->deallocate(storage, sizeof(Impl), alignof(Impl));
+                throw;
+            }
+            auto new_slot = std::shared_ptr<Impl>(impl, [resource](Impl* ptr) {
+                std::destroy_at(ptr);
+                resource->deallocate(ptr, sizeof(Impl), alignof(Impl));
+            });
+            new_slot->resource_ = resource;
+            return new_slot;
+        }
+
+        template <emittable Signal, typename Threading>
+        struct emitter_unit {
+            static_assert(!combined<Signal> || !std::same_as<Threading, single_threaded>,
+                "Combining signals merge emissions from many threads; a single_threaded emitter has one.");
+
+            using slot      = std::shared_ptr<slot_base<signal_degradation_t<Signal>, Threading>>;
+            using slot_list = std::pmr::vector<slot>;
+
+            emitter_unit() = default;
+            ~emitter_unit() {
+                // Stop policy timers before the scope drains, so nothing is spawned into a dead scope.
+                Close_slots();
+            }
+
+        private:
+            template <typename, emittable...>
+            friend struct emitter_impl;
+            friend struct connect_t<Signal>;
+            friend struct connect_if_t<Signal>;
+            friend struct disconnect_t<Signal>;
+            friend struct emit_t;
+            friend struct publish_t;
+            friend struct unit_access;
+
+            template <typename Policy, typename SenderClosure>
+            slot Register(Policy&& policy, SenderClosure&& sender_closure) {
+                confinement_.Check();
+                slot new_slot = Make_slot<slot_impl<signal_degradation_t<Signal>, 
+                    std::decay_t<SenderClosure>, std::decay_t<Policy>, Threading>>(
+                        std::forward<Policy>(policy), std::forward<SenderClosure>(sender_closure));
+
+                std::shared_ptr<slot_list> old_slots = slots_.load(std::memory_order_acquire);
+                std::shared_ptr<slot_list> new_slots;
+
+                do {
+                    if (old_slots) [[likely]] {
+                        new_slots = std::allocate_shared<slot_list>(Allocator(), *old_slots);
+                    } else {
+                        new_slots = std::allocate_shared<slot_list>(Allocator());
+                    }
+                    new_slots->push_back(new_slot);
+                } while (!slots_.compare_exchange_weak(
+                            old_slots, new_slots,
+                            std::memory_order_release, 
+                            std::memory_order_acquire
+                        ));
+
+                return new_slot;
+            }
+
+            template <typename Predicate, typename K, typename SenderClosure>
+            slot Register_indexed(K&& key, SenderClosure&& sender_closure) {
+                using index_info = index_of<Predicate, signal_degradation_t<Signal>>;
+                using index      = slot_index<signal_degradation_t<Signal>, Predicate::index, typename index_info::key, Threading>;
+
+                confinement_.Check();
+                slot new_slot = Make_slot<slot_impl<signal_degradation_t<Signal>, 
+                    std::decay_t<SenderClosure>, no_policy, Threading>>(no_policy{}, std::forward<SenderClosure>(sender_closure));
+
+                auto target = Find_or_add<index>([](const index&) { return true; }, [&]() { return std::allocate_shared<index>(Allocator()); });
+                target->Insert(typename index_info::key(std::forward<K>(key)), new_slot);
+                return new_slot;
+            }
+
+            template <typename Group, typename SenderClosure>
+            slot Register_grouped(Group&& group, SenderClosure&& sender_closure) {
+                using strategy  = typename std::decay_t<Group>::strategy;
+                using composite = slot_group<signal_degradation_t<Signal>, strategy, Threading>;
+
+                confinement_.Check();
+                slot new_slot;
+                std::shared_ptr<std::atomic<std::size_t>> load;
+                if constexpr (strategy::tracks_load) {
+                    load = std::allocate_shared<std::atomic<std::size_t>>(Allocator(), 0);
+                    new_slot = Make_slot<slot_impl<signal_degradation_t<Signal>, 
+                        std::decay_t<SenderClosure>, load_tracking, Threading>>(load_tracking{load}, std::forward<SenderClosure>(sender_closure));
+                }
+                else {
+                    new_slot = Make_slot<slot_impl<signal_degradation_t<Signal>, 
+                        std::decay_t<SenderClosure>, no_policy, Threading>>(no_policy{}, std::forward<SenderClosure>(sender_closure));
+                }
+
+                auto target = Find_or_add<composite>(
+                    [&](const composite& existing) { return existing.name_ == group.name_; },
+                    [&]() { return std::allocate_shared<composite>(Allocator(), group.name_); });
+                target->Join(new_slot, std::move(load));
+                return new_slot;
+            }
+
+            // The slot goes into its node's partition, allocated from the node's resource when the domain has one.
+            template <typename Placement, typename SenderClosure>
+            slot Register_placed(const Placement& placement, SenderClosure&& sender_closure) {
+                static_assert(!std::same_as<Threading, single_threaded>, 
+                    "numa_local walks partitions on the threads of other nodes; a single_threaded emitter stays on one.");
+                using composite = slot_partitions<signal_degradation_t<Signal>>;
+                using impl      = slot_impl<signal_degradation_t<Signal>, std::decay_t<SenderClosure>>;
+
+                std::pmr::memory_resource* resource = placement.domain_->resource(placement.node_);
+                if (!resource) {
+                    resource = resource_;
+                }
+                auto new_slot = make_slot_on<impl>(resource, no_policy{}, std::forward<SenderClosure>(sender_closure));
+                new_slot->node_     = placement.node_;
+
+                auto target = Find_or_add<composite>(
+                    [&](const composite& existing) { return existing.domain_ == placement.domain_; },
+                    [&]() { return std::allocate_shared<composite>(Allocator(), *placement.domain_); });
+                target->Join(placement.node_, new_slot);
+                return new_slot;
+            }
+
+            // Returns the first composite slot of this type accepted by match, publishing a new one if there is none.
+            template <typename Composite, typename Match, typename Make>
+            std::shared_ptr<Composite> Find_or_add(Match&& match, Make&& make) {
+                std::shared_ptr<slot_list> old_slots = slots_.load(std::memory_order_acquire);
+                std::shared_ptr<slot_list> new_slots;
+                std::shared_ptr<Composite>         target;
+
+                do {
+                    if (old_slots) [[likely]] {
+                        for (auto& slot_ptr : *old_slots) {
+                            auto existing = std::dynamic_pointer_cast<Composite>(slot_ptr);
+                            if (existing && match(*existing)) {
+                                return existing;
+                            }
+                        }
+                        new_slots = std::allocate_shared<slot_list>(Allocator(), *old_slots);
+                    } else {
+                        new_slots = std::allocate_shared<slot_list>(Allocator());
+                    }
+                    if (!target) {
+                        target = make();
+                    }
+                    new_slots->push_back(target);
+                } while (!slots_.compare_exchange_weak(
+                            old_slots, new_slots,
+                            std::memory_order_release, 
+                            std::memory_order_acquire
+                        ));
+
+                return target;
+            }
+
+            bool Unregister(slot&& ptr) {
+                confinement_.Check();
+                std::shared_ptr<slot_list> old_slots = slots_.load(std::memory_order_acquire);
+                std::shared_ptr<slot_list> new_slots;
+
+                if (old_slots && std::find(old_slots->begin(), old_slots->end(), ptr) == old_slots->end()) {
+                    for (auto& slot_ptr : *old_slots) {
+                        if (slot_ptr->Remove_member(ptr)) {
+                            ptr->Close();
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+                do {
+                    if (old_slots) [[likely]] {
+                        new_slots = std::allocate_shared<slot_list>(Allocator(), *old_slots);
+                    } else {
+                        new_slots = std::allocate_shared<slot_list>(Allocator());
+                    }
+                    auto it = std::remove(new_slots->begin(), new_slots->end(), ptr);
+                    if (it == new_slots->end()) {
+                        return false;
+                    }
+                    else {
+                        new_slots->erase(it);
+                    }
+                } while (!slots_.compare_exchange_weak(
+                            old_slots, new_slots,
+                            std::memory_order_release, 
+                            std::memory_order_acquire
+                        ));
+
+                ptr->Close();
+                return true;
+            }
+
+            void Close_slots() noexcept {
+                auto current_slots = slots_.load(std::memory_order_acquire);
+                if (current_slots) {
+                    for (auto& slot_ptr : *current_slots) {
+                        slot_ptr->Close();
+                    }
+                }
+            }
+
+            template <typename...Args>
+            void Broadcast(exec::async_scope* scope, const Args&... args) {
+                confinement_.Check();
+                if constexpr (combined<Signal>) {
+                    combiner_.Broadcast(slots_, scope, resource_, args...);
+                }
+                else {
+                    auto current_slots = slots_.load(std::memory_order_acquire);
+
+                    if (current_slots) [[likely]] {
+                        for (auto& slot_ptr : *current_slots) {
+                            slot_ptr->Invoke(scope, nullptr, args...);
+                        }
+                    }
+                }
+            }
+
+            template <typename...SenderClosures>
+            void Check(const connection_signatures<Signal, SenderClosures, Threading>&... cons) {
+                confinement_.Check();
+                auto current_slots = slots_.load(std::memory_order_acquire);
+                if (current_slots) [[likely]] {
+                    constexpr std::size_t size = []() consteval {
+                        std::size_t size = sizeof...(SenderClosures) - 1;
+                        for (int i = 1; i <= 32; i <<= 1)
+                            size |= size >> i;
+                        return size + 1;
+                    }();
+                    std::cout << "s:" << size << std::endl;
+                    void* hash_table[size] = {nullptr};
+                    std::hash<void*> hasher{};
+
+                    auto make_hash_table = [&](const auto& con) {
+                        auto ptr = con.Lock();
+                        if (!ptr) {
+                            throw std::runtime_error("Can't create sender: the connection has been closed.");
+                        }
+                        auto p = (void*)(&*ptr);
+                        auto hash_idx = hasher(p) & (size - 1);
+                        while (hash_table[hash_idx] != nullptr) {
+                            hash_idx = (hash_idx + 1) & (size - 1); 
+                        }
+                        hash_table[hash_idx] = p;
+                    };
+                    (make_hash_table(cons), ...);
+
+                    auto contains = [](const void* table, const void* ptr) -> bool {
+                        auto slots = static_cast<void* const*>(table);
+                        auto p = const_cast<void*>(ptr);
+                        auto hash_idx = std::hash<void*>{}(p) & (size - 1);
+                        for (int i = 0; i < size && slots[hash_idx]; i++) {
+                            if (slots[hash_idx] == p) {
+                                return true;
+                            }
+                            else {
+                                hash_idx = (hash_idx + 1) & (size - 1); 
+                            }
+                        }
+                        return false;
+                    };
+
+                    std::size_t count = 0;
+                    for (auto& slot_ptr : *current_slots) {
+                        count += contains(hash_table, slot_ptr.get());
+                        count += slot_ptr->Count_members(contains, hash_table);
+                    }
+
+                    if (count == sizeof...(SenderClosures)) {
+                        return;
+                    }
+                }
+
+                throw std::runtime_error("Can't create sender: the connection is not connected to the emmiter or there are the same connections.");
+            }
+
+            template <typename Impl, typename...Ts>
+            std::shared_ptr<Impl> Make_slot(Ts&&...args) {
+                return make_slot_on<Impl>(resource_, std::forward<Ts>(args)...);
+            }
+
+            std::pmr::polymorphic_allocator<std::byte> Allocator() const noexcept {
+                return resource_;
+            }
+
+            typename Threading::template atomic<std::shared_ptr<slot_list>> slots_;
+            std::pmr::memory_resource*                                       resource_ = std::pmr::get_default_resource();
+            DAKING_NO_UNIQUE_ADDRESS typename combiner_of<Signal>::type       combiner_;
+            DAKING_NO_UNIQUE_ADDRESS typename Threading::confinement          confinement_;
+        };
+
+        inline constexpr std::size_t cache_line = 64;
+
+        DAKING_ALWAYS_INLINE inline void spin_pause(std::size_t round) noexcept {
+            if (round < 64) {
+#if defined(__x86_64__) || defined(__i386__)
+                __builtin_ia32_pause();
+#elif defined(__aarch64__)
+                asm volatile("yield");
+#endif
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+
+        // A small index per thread that emits combining signals, so that publication records can live in an
+        // array. Indexes of exited threads are reused; the registry is never destroyed, since threads may
+        // exit after static destruction has begun.
+        struct combining_thread {
+            static std::size_t Index() {
+                thread_local combining_thread self;
+                return self.index_;
+            }
+
+            // One past the highest index handed out so far.
+            static std::size_t Bound() noexcept {
+                return Registry().next_.load(std::memory_order_acquire);
+            }
+
+        private:
+            struct registry {
+                std::mutex               mutex_;
+                std::vector<std::size_t> free_;
+                std::atomic<std::size_t> next_ = 0;
+            };
+
+            static registry& Registry() {
+                static registry* instance = new registry;
+                return *instance;
+            }
+
+            combining_thread() {
+                registry& shared = Registry();
+                std::lock_guard<std::mutex> lock(shared.mutex_);
+                if (shared.free_.empty()) {
+                    index_ = shared.next_.fetch_add(1, std::memory_order_release);
+                }
+                else {
+                    index_ = shared.free_.back();
+                    shared.free_.pop_back();
+                }
+            }
+
+            ~combining_thread() {
+                registry& shared = Registry();
+                std::lock_guard<std::mutex> lock(shared.mutex_);
+                shared.free_.push_back(index_);
+            }
+
+            std::size_t index_;
+        };
+
+        // Set while a thread runs a combined pass. Emissions of combining signals made from inside one, by
+        // slots that run inline, broadcast directly: waiting on another combiner from there could deadlock.
+        inline thread_local bool combining_now = false;
+
+        struct no_combiner {};
+
+        // Flat combining for one unit. An uncontended producer takes the lock and broadcasts at once, as
+        // without combining. Under contention producers publish their emission in their record and spin;
+        // the lock holder gathers every pending record and walks the slot list once, invoking each slot for
+        // each emission in turn, so each slot's lines are touched once per batch instead of once per
+        // producer. A producer returns once its emission has been dispatched, and an exception thrown for it
+        // is rethrown on its own thread; the other emissions of the batch carry on. The records are allocated
+        // from the unit's resource on the first contended emission, and a count of published ones lets a pass
+        // with nothing waiting skip scanning them.
+        template <emittable Signal, std::size_t Records>
+        struct broadcast_combiner;
+
+        template <typename...Args, std::size_t Records>
+        struct broadcast_combiner<signal<Args...>, Records> {
+            static_assert(Records > 0, "combining_records must be positive.");
+
+            struct alignas(cache_line) record {
+                std::atomic_bool                   pending_ = false;
+                exec::async_scope*                 scope_   = nullptr;
+                std::optional<std::tuple<Args...>> args_;
+                std::exception_ptr                 error_;
+            };
+
+            broadcast_combiner() = default;
+
+            ~broadcast_combiner() {
+                if (record* records = records_.load(std::memory_order_acquire)) {
+                    std::destroy_n(records, Records);
+                    resource_->deallocate(records, sizeof(record) * Records, alignof(record));
+                }
+            }
+
+            template <typename SlotList>
+            void Broadcast(const std::atomic<std::shared_ptr<SlotList>>& slots, exec::async_scope* scope, 
+                std::pmr::memory_resource* resource, const Args&...args) {
+                std::size_t index = combining_thread::Index();
+                if (index >= Records || combining_now) [[unlikely]] {
+                    if (auto current_slots = slots.load(std::memory_order_acquire)) {
+                        for (auto& slot_ptr : *current_slots) {
+                            slot_ptr->Invoke(scope, nullptr, args...);
+                        }
+                    }
+                    return;
+                }
+
+                std::exception_ptr error;
+                if (Try_lock()) [[likely]] {
+                    auto own = std::forward_as_tuple(args...);
+                    Pass(slots, scope, &own, error);
+                }
+                else {
+                    record& mine = Records_from(resource)[index];
+                    mine.scope_ = scope;
+                    mine.args_.emplace(args...);
+                    waiting_.fetch_add(1, std::memory_order_release);
+                    mine.pending_.store(true, std::memory_order_release);
+                    for (std::size_t round = 0; mine.pending_.load(std::memory_order_acquire); round++) {
+                        if (Try_lock()) {
+                            if (mine.pending_.load(std::memory_order_acquire)) {
+                                Pass(slots, scope, static_cast<std::tuple<const Args&...>*>(nullptr), error);
+                            }
+                            else {
+                                Unlock();
+                            }
+                            break;
+                        }
+                        spin_pause(round);
+                    }
+                    error = std::exchange(mine.error_, nullptr);
+                }
+                if (error) [[unlikely]] {
+                    std::rethrow_exception(error);
+                }
+            }
+
+        private:
+            // Runs the caller's own emission, if any, and every pending record over one snapshot, then
+            // releases the lock.
+            template <typename SlotList>
+            void Pass(const std::atomic<std::shared_ptr<SlotList>>& slots, exec::async_scope* scope, 
+                const std::tuple<const Args&...>* own, std::exception_ptr& error) {
+                record*     batch[Records];
+                std::size_t count = 0;
+                // A record counted here may not show as pending yet; its producer spins and is served later.
+                if (waiting_.load(std::memory_order_acquire) != 0) {
+                    record*     records = records_.load(std::memory_order_acquire);
+                    std::size_t bound   = std::min(combining_thread::Bound(), Records);
+                    for (std::size_t i = 0; i < bound; i++) {
+                        if (records[i].pending_.load(std::memory_order_acquire)) {
+                            batch[count++] = &records[i];
+                        }
+                    }
+                }
+
+                combining_now = true;
+                if (auto current_slots = slots.load(std::memory_order_acquire)) [[likely]] {
+                    for (auto& slot_ptr : *current_slots) {
+                        if (own && !error) {
+                            try {
+                                std::apply([&](const Args&...args) { slot_ptr->Invoke(scope, nullptr, args...); }, *own);
+                            }
+                            catch (...) {
+                                error = std::current_exception();
+                            }
+                        }
+                        for (std::size_t k = 0; k < count; k++) {
+                            record& other = *batch[k];
+                            if (!other.error_) {
+                                try {
+                                    std::apply([&](const Args&...args) { slot_ptr->Invoke(other.scope_, nullptr, args...); }, *other.args_);
+                                }
+                                catch (...) {
+                                    other.error_ = std::current_exception();
+                                }
+                            }
+                        }
+                    }
+                }
+                combining_now = false;
+
+                for (std::size_t k = 0; k < count; k++) {
+                    batch[k]->args_.reset();
+                    batch[k]->pending_.store(false, std::memory_order_release);
+                }
+                if (count) {
+                    waiting_.fetch_sub(count, std::memory_order_relaxed);
+                }
+                Unlock();
+            }
+
+            record* Records_from(std::pmr::memory_resource* resource) {
+                record* records = records_.load(std::memory_order_acquire);
+                if (!records) [[unlikely]] {
+                    auto fresh = static_cast<record*>(resource->allocate(sizeof(record) * Records, alignof(record)));
+                    std::uninitialized_default_construct_n(fresh, Records);
+                    if (records_.compare_exchange_strong(records, fresh, std::memory_order_acq_rel)) {
+                        resource_ = resource;
+                        records   = fresh;
+                    }
+                    else {
+                        std::destroy_n(fresh, Records);
+                        resource->deallocate(fresh, sizeof(record) * Records, alignof(record));
+                    }
+                }
+                return records;
+            }
+
+            bool Try_lock() noexcept {
+                return !locked_.load(std::memory_order_relaxed) && !locked_.exchange(true, std::memory_order_acquire);
+            }
+
+            void Unlock() noexcept {
+                locked_.store(false, std::memory_order_release);
+            }
+
+            alignas(cache_line) std::atomic_bool locked_   = false;
+            std::atomic<std::size_t>             waiting_  = 0;
+            std::atomic<record*>                 records_  = nullptr;
+            std::pmr::memory_resource*           resource_ = nullptr;
+        };
+
+        template <emittable Signal>
+        struct combiner_of {
+            using type = no_combiner;
+        };
+
+        template <emittable Signal>
+            requires combined<Signal>
+        struct combiner_of<Signal> {
+            using type = broadcast_combiner<signal_degradation_t<Signal>, Signal::combining_records>;
+        };
+
+        // Shared state of a ring-backed signal. Producers claim a sequence, wait until the slowest consumer
+        // has left that cell, write it in place and publish in claim order; consumers read published cells
+        // directly and advance their own cursor once per batch.
+        template <typename...Args>
+        struct ring_core {
+            struct alignas(cache_line) cell {
+                std::tuple<Args...> value_;
+            };
+
+            struct alignas(cache_line) sequence {
+                std::atomic<std::int64_t> value_ = -1;
+            };
+
+            explicit ring_core(std::size_t capacity) : cells_(new cell[capacity]), mask_(capacity - 1) {}
+
+            template <typename Gates>
+            void Publish(const Gates& gates, const Args&...args) {
+                std::int64_t seq  = claim_.value_.fetch_add(1, std::memory_order_relaxed) + 1;
+                std::int64_t wrap = seq - static_cast<std::int64_t>(mask_ + 1);
+                if (wrap > gate_.value_.load(std::memory_order_relaxed)) {
+                    std::int64_t gate;
+                    for (std::size_t round = 0; wrap > (gate = Minimum(gates, seq - 1)); round++) {
+                        spin_pause(round);
+                    }
+                    gate_.value_.store(gate, std::memory_order_relaxed);
+                }
+
+                cells_[seq & mask_].value_ = std::forward_as_tuple(args...);
+
+                for (std::size_t round = 0; cursor_.value_.load(std::memory_order_acquire) != seq - 1; round++) {
+                    spin_pause(round);
+                }
+                cursor_.value_.store(seq, std::memory_order_release);
+
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (sleepers_.load(std::memory_order_relaxed)) {
+                    Wake();
+                }
+            }
+
+            // Returns the highest published sequence, which is below next only when the waiter should exit.
+            template <typename Consumer>
+            std::int64_t Wait_for(std::int64_t next, const Consumer& consumer) {
+                for (std::size_t round = 0;; round++) {
+                    std::int64_t available = cursor_.value_.load(std::memory_order_acquire);
+                    if (available >= next || consumer.stop_.load(std::memory_order_acquire) || closing_.load(std::memory_order_acquire)) {
+                        return available;
+                    }
+                    if (round < 128) {
+                        spin_pause(round);
+                        continue;
+                    }
+                    std::uint32_t epoch = epoch_.load(std::memory_order_acquire);
+                    sleepers_.fetch_add(1, std::memory_order_seq_cst);
+                    if (cursor_.value_.load(std::memory_order_seq_cst) < next 
+                        && !consumer.stop_.load(std::memory_order_acquire) && !closing_.load(std::memory_order_acquire)) {
+                        epoch_.wait(epoch, std::memory_order_acquire);
+                    }
+                    sleepers_.fetch_sub(1, std::memory_order_relaxed);
+                }
+            }
+
+            void Wake() noexcept {
+                epoch_.fetch_add(1, std::memory_order_release);
+                epoch_.notify_all();
+            }
+
+            const std::tuple<Args...>& At(std::int64_t seq) const noexcept {
+                return cells_[seq & mask_].value_;
+            }
+
+            template <typename Gates>
+            static std::int64_t Minimum(const Gates& gates, std::int64_t fallback) {
+                auto current = gates.load(std::memory_order_acquire);
+                std::int64_t least = fallback;
+                if (current) {
+                    for (auto& consumer : *current) {
+                        least = std::min(least, consumer->sequence_.value_.load(std::memory_order_acquire));
+                    }
+                }
+                return least;
+            }
+
+            std::unique_ptr<cell[]>    cells_;
+            const std::size_t          mask_;
+            sequence                   claim_;
+            sequence                   cursor_;
+            sequence                   gate_;     // cached minimum of the consumer cursors
+            alignas(cache_line) std::atomic<std::uint32_t> epoch_ = 0;
+            std::atomic<std::uint32_t> sleepers_ = 0;
+            std::atomic_bool           closing_  = false;
+        };
+
+        template <typename...Args>
+        struct ring_consumer_base : slot_base<signal<Args...>> {
+            typename ring_core<Args...>::sequence sequence_;
+            std::atomic_bool                      stop_ = false;
+            std::thread                           thread_;
+        };
+
+        // Completes a consumer's operation in place: bumps a counter the consumer thread waits on only
+        // when the closure finished asynchronously, so the common synchronous case never blocks.
+        struct ring_receiver {
+            using receiver_concept = stdexec::receiver_t;
+
+            template <typename...Values>
+            void set_value(Values&&...) && noexcept {
+                Complete();
+            }
+
+            template <typename Error>
+            void set_error(Error&&) && noexcept {
+                Complete();
+            }
+
+            void set_stopped() && noexcept {
+                Complete();
+            }
+
+            void Complete() noexcept {
+                completions_->fetch_add(1, std::memory_order_release);
+                completions_->notify_one();
+            }
+
+            std::atomic<std::uint32_t>* completions_;
+        };
+
+        // A consumer runs its closure on its own thread, one emission at a time and in sequence order.
+        template <typename Signal, typename SenderClosure>
+        struct ring_consumer;
+
+        template <typename...Args, typename SenderClosure>
+        struct ring_consumer<signal<Args...>, SenderClosure> : ring_consumer_base<Args...> {
+            template <typename C>
+            ring_consumer(C&& closure) : closure_(std::forward<C>(closure)) {}
+
+            std::pmr::memory_resource* resource_ = std::pmr::get_default_resource();
+
+            void Invoke(exec::async_scope* scope, void* sender, const Args&...args) override {
+                if (this->enabled_.load(std::memory_order_acquire)) {
+                    if (sender) {
+                        auto future_sender = closure_.Visit([&](const SenderClosure& closure) {
+                            return scope->spawn_future(stdexec::just(args...) | closure, capture_env{this->resource_});
+                        });
+                        auto target = (std::optional<decltype(future_sender)>*)sender;
+                        *target = std::move(future_sender);
+                    }
+                    else {
+                        std::uint32_t ticket = completions_.load(std::memory_order_relaxed);
+                        closure_.Visit([&](const SenderClosure& closure) {
+                            auto op = stdexec::connect(stdexec::just(args...) | closure, ring_receiver{&completions_});
+                            stdexec::start(op);
+                        });
+                        for (std::uint32_t seen; (seen = completions_.load(std::memory_order_acquire)) == ticket;) {
+                            completions_.wait(seen, std::memory_order_acquire);
+                        }
+                    }
+                }
+            }
+
+            bool Replace(void* closure) override {
+                closure_.Replace(std::move(*static_cast<SenderClosure*>(closure)));
+                return true;
+            }
+
+            static void Run(std::shared_ptr<ring_consumer> self, std::shared_ptr<ring_core<Args...>> core) {
+                std::int64_t next = self->sequence_.value_.load(std::memory_order_acquire) + 1;
+                for (;;) {
+                    std::int64_t available = core->Wait_for(next, *self);
+                    if (available < next || self->stop_.load(std::memory_order_relaxed)) {
+                        return;
+                    }
+                    for (; next <= available && !self->stop_.load(std::memory_order_relaxed); next++) {
+                        std::apply([&](const Args&...args) { self->Invoke(nullptr, nullptr, args...); }, core->At(next));
+                    }
+                    self->sequence_.value_.store(next - 1, std::memory_order_release);
+                }
+            }
+
+            closure_cell<SenderClosure> closure_;
+            std::atomic<std::uint32_t>  completions_ = 0;
+        };
+
+        // Ring-backed unit: emission costs one claim, one in-place write and one publish, whatever the consumer count.
+        template <emittable Signal, typename Threading>
+            requires ring_backed<Signal>
+        struct emitter_unit<Signal, Threading> {
+            static_assert(Signal::ring_capacity > 0 && (Signal::ring_capacity & (Signal::ring_capacity - 1)) == 0, 
+                "ring_capacity must be a power of two.");
+            static_assert(!std::same_as<Threading, single_threaded>,
+                "Ring signals run each consumer on its own thread; a single_threaded emitter stays on one.");
+
+            using slot = std::shared_ptr<slot_base<signal_degradation_t<Signal>>>;
+
+            emitter_unit() = default;
+            ~emitter_unit() {
+                Close_slots();
+                if (auto current = consumers_.load(std::memory_order_acquire)) {
+                    for (auto& consumer : *current) {
+                        Join(*consumer);
+                    }
+                }
+            }
+
+        private:
+            template <typename, emittable...>
+            friend struct emitter_impl;
+            friend struct connect_t<Signal>;
+            friend struct disconnect_t<Signal>;
+            friend struct emit_t;
+            friend struct publish_t;
+            friend struct unit_access;
+
+            template <typename...Args>
+            static auto Core_of(signal<Args...>*) -> ring_core<Args...>;
+            template <typename...Args>
+            static auto Consumer_of(signal<Args...>*) -> ring_consumer_base<Args...>;
+
+            using core          = decltype(Core_of(std::declval<signal_degradation_t<Signal>*>()));
+            using consumer      = decltype(Consumer_of(std::declval<signal_degradation_t<Signal>*>()));
+            using consumer_list = std::pmr::vector<std::shared_ptr<consumer>>;
+
+            template <typename Policy, typename SenderClosure>
+            std::weak_ptr<slot_base<signal_degradation_t<Signal>>> Register(Policy&&, SenderClosure&& sender_closure) {
+                static_assert(std::same_as<std::decay_t<Policy>, no_policy>, 
+                    "Every consumer of a ring signal reads every emission; connection policies do not apply.");
+                using consumer_impl = ring_consumer<signal_degradation_t<Signal>, std::decay_t<SenderClosure>>;
+
+                std::lock_guard<std::mutex> lock(mutex_);
+                auto new_consumer = make_slot_on<consumer_impl>(resource_, std::forward<SenderClosure>(sender_closure));
+                new_consumer->sequence_.value_.store(core_->cursor_.value_.load(std::memory_order_acquire), std::memory_order_relaxed);
+
+                auto old_consumers = consumers_.load(std::memory_order_acquire);
+                auto new_consumers = old_consumers 
+                    ? std::allocate_shared<consumer_list>(Allocator(), *old_consumers) 
+                    : std::allocate_shared<consumer_list>(Allocator());
+                new_consumers->push_back(new_consumer);
+                consumers_.store(std::move(new_consumers), std::memory_order_release);
+
+                // Producers gate on the consumer from here on, so it can safely join at the current cursor.
+                new_consumer->sequence_.value_.store(core_->cursor_.value_.load(std::memory_order_acquire), std::memory_order_release);
+                new_consumer->thread_ = std::thread(&consumer_impl::Run, new_consumer, core_);
+                return new_consumer;
+            }
+
+            bool Unregister(std::shared_ptr<slot_base<signal_degradation_t<Signal>>>&& ptr) {
+                std::shared_ptr<consumer> target;
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    auto current = consumers_.load(std::memory_order_acquire);
+                    if (!current) {
+                        return false;
+                    }
+                    auto found = std::find_if(current->begin(), current->end(), 
+                        [&](const std::shared_ptr<consumer>& c) { return c.get() == ptr.get(); });
+                    if (found == current->end() || (*found)->stop_.exchange(true, std::memory_order_acq_rel)) {
+                        return false;
+                    }
+                    target = *found;
+                }
+
+                // Joined without the lock, since its closure may connect or disconnect on this emitter.
+                // Producers keep gating on it until it has exited, so the cell it reads is never overwritten.
+                core_->Wake();
+                Join(*target);
+
+                std::lock_guard<std::mutex> lock(mutex_);
+                auto old_consumers = consumers_.load(std::memory_order_acquire);
+                auto new_consumers = std::allocate_shared<consumer_list>(Allocator(), *old_consumers);
+                std::erase(*new_consumers, target);
+                consumers_.store(std::move(new_consumers), std::memory_order_release);
+                return true;
+            }
+
+            // Consumers drain what was published, then exit.
+            void Close_slots() noexcept {
+                core_->closing_.store(true, std::memory_order_release);
+                core_->Wake();
+            }
+
+            template <typename...Args>
+            DAKING_ALWAYS_INLINE void Broadcast(exec::async_scope*, const Args&... args) {
+                auto current = consumers_.load(std::memory_order_acquire);
+                if (current && !current->empty()) [[likely]] {
+                    core_->Publish(consumers_, args...);
+                }
+            }
+
+            static void Join(consumer& target) {
+                if (target.thread_.get_id() == std::this_thread::get_id()) {
+                    target.thread_.detach(); // Disconnected from its own closure: it exits once the closure returns.
+                }
+                else if (target.thread_.joinable()) {
+                    target.thread_.join();
+                }
+            }
+
+            std::pmr::polymorphic_allocator<std::byte> Allocator() const noexcept {
+                return resource_;
+            }
+
+            // The ring is allocated with the unit, before a resource can be set; consumers and their list use it.
+            std::shared_ptr<core>                       core_ = std::make_shared<core>(Signal::ring_capacity);
+            std::atomic<std::shared_ptr<consumer_list>> consumers_;
+            std::mutex                                  mutex_;
+            std::pmr::memory_resource*                  resource_ = std::pmr::get_default_resource();
+        };
+
+        struct timer_registry;
+
+        struct timed_emission_base : timer_node {
+            timed_emission_base(timer_wheel::clock::duration period) : period_(period) {
+                this->fire_ = &Fire;
+            }
+            virtual ~timed_emission_base() = default;
+
+            bool Cancel();
+
+            virtual void Emit() = 0;
+
+            static void Fire(timer_node* node);
+
+            void Dispatch();
+
+            timer_wheel::clock::duration         period_; // zero for one-shot emissions
+            std::atomic<std::thread::id>         emitting_;
+            timer_registry*                      registry_      = nullptr;
+            timed_emission_base*                 registry_prev_ = nullptr;
+            timed_emission_base*                 registry_next_ = nullptr;
+            std::shared_ptr<timed_emission_base> self_;
+            std::atomic_bool                     done_ = false;
+        };
+
+        // Armed timed emissions of one emitter; they hold themselves alive until they finish or are cancelled.
+        struct timer_registry {
+            void Add(std::shared_ptr<timed_emission_base>&& emission) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                emission->registry_      = this;
+                emission->registry_next_ = head_;
+                if (head_) {
+                    head_->registry_prev_ = emission.get();
+                }
+                head_ = emission.get();
+                head_->self_ = std::move(emission);
+            }
+
+            std::shared_ptr<timed_emission_base> Remove(timed_emission_base* emission) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (emission->registry_prev_) {
+                    emission->registry_prev_->registry_next_ = emission->registry_next_;
+                }
+                else {
+                    head_ = emission->registry_next_;
+                }
+                if (emission->registry_next_) {
+                    emission->registry_next_->registry_prev_ = emission->registry_prev_;
+                }
+                emission->registry_prev_ = emission->registry_next_ = nullptr;
+                return std::move(emission->self_);
+            }
+
+            void Cancel_all() {
+                for (;;) {
+                    std::shared_ptr<timed_emission_base> emission;
+                    {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        if (!head_) {
+                            return;
+                        }
+                        emission = head_->self_;
+                    }
+                    if (!emission->Cancel()) {
+                        // Finishing concurrently on another thread, which unlinks it.
+                        std::this_thread::yield();
+                    }
+                }
+            }
+
+            std::mutex           mutex_;
+            timed_emission_base* head_ = nullptr;
+        };
+
+        inline bool timed_emission_base::Cancel() {
+            if (done_.exchange(true)) {
+                return false;
+            }
+            // An emission already handed to the dispatch pool may still be broadcasting; the emitter
+            // must outlive it. A slot cancelling its own timer is running on that thread and must not wait.
+            for (auto id = emitting_.load(); id != std::thread::id{} && id != std::this_thread::get_id(); id = emitting_.load()) {
+                emitting_.wait(id);
+            }
+            timer_wheel::shared().cancel(this);
+            auto self = registry_->Remove(this);
+            return true;
+        }
+
+        // Runs on the wheel thread: re-arms periodic emissions to keep their cadence and posts the
+        // broadcast itself to the timer dispatch pool, so slots never run on (or delay) the wheel.
+        inline void timed_emission_base::Fire(timer_node* node) {
+            auto self = static_cast<timed_emission_base*>(node);
+            if (self->done_.load(std::memory_order_acquire)) {
+                return;
+            }
+            if (self->period_ != timer_wheel::clock::duration::zero()) {
+                timer_wheel::shared().schedule(self, self->period_);
+            }
+            timer_dispatch::shared().Post([keep = self->self_]() { keep->Dispatch(); });
+        }
+
+        inline void timed_emission_base::Dispatch() {
+            emitting_.store(std::this_thread::get_id());
+            if (!done_.load()) {
+                Emit();
+                if (period_ == timer_wheel::clock::duration::zero() && !done_.exchange(true)) {
+                    registry_->Remove(this);
+                }
+            }
+            emitting_.store(std::thread::id{});
+            emitting_.notify_all();
+        }
+
+        // A scope that outlives the emitters joined to it. Their slot work is tracked here instead of in
+        // a scope of their own, so destroying one neither blocks nor waits.
+        class scope_group {
+        public:
+            scope_group() = default;
+            ~scope_group() {
+                stdexec::sync_wait(scope_.on_empty());
+            }
+
+            scope_group(const scope_group&)            = delete;
+            scope_group& operator=(const scope_group&) = delete;
+
+            // Completes once everything spawned so far by the members has finished.
+            auto close() {
+                return scope_.on_empty();
+            }
+
+        private:
+            friend struct emitter_scope;
+            template <emittable...Signals>
+            friend struct compact_emitter_impl;
+
+            exec::async_scope scope_;
+        };
+
+        struct emitter_scope {
+            emitter_scope() = default;
+            ~emitter_scope() {
+                if (spawn_ == &scope_) {
+                    stdexec::sync_wait(scope_.on_empty()); 
+                }
+                delete timers_.load(std::memory_order_acquire);
+            }
+
+            // Where slot work is spawned: the emitter's own scope, or its group's.
+            DAKING_ALWAYS_INLINE exec::async_scope* Scope() noexcept {
+                return spawn_;
+            }
+
+            // The scope for a new connection; a closed emitter takes none.
+            exec::async_scope* Open_scope() {
+                if (Is_closed()) [[unlikely]] {
+                    throw std::runtime_error("Can't connect: the emitter has been closed.");
+                }
+                return spawn_;
+            }
+
+            DAKING_ALWAYS_INLINE bool Is_closed() const noexcept {
+                return closed_.load(std::memory_order_acquire);
+            }
+
+            void Join(scope_group& group) noexcept {
+                spawn_ = &group.scope_;
+            }
+
+            timer_registry& Timers() {
+                timer_registry* timers = timers_.load(std::memory_order_acquire);
+                if (!timers) [[unlikely]] {
+                    auto fresh = new timer_registry;
+                    if (timers_.compare_exchange_strong(timers, fresh, std::memory_order_acq_rel)) {
+                        timers = fresh;
+                    }
+                    else {
+                        delete fresh;
+                    }
+                }
+                return *timers;
+            }
+
+            void Cancel_timers() {
+                if (auto timers = timers_.load(std::memory_order_acquire)) {
+                    timers->Cancel_all();
+                }
+            }
+
+            exec::async_scope            scope_;
+            exec::async_scope*           spawn_  = &scope_;
+            std::atomic<timer_registry*> timers_ = nullptr;
+            std::atomic_bool             closed_ = false;
+        };
+
+        template <typename Threading, emittable... Signals>
+        struct emitter_impl : emitter_unit<Signals, Threading>..., virtual emitter_scope {
+            friend struct emit_t;
+
+            using threading = Threading;
+
+            static_assert(sizeof...(Signals) > 0, "Emitter should at least emit one kind of signal.");
+
+            emitter_impl() = default;
+            explicit emitter_impl(scope_group& group) noexcept {
+                this->Join(group);
+            }
+
+            // Slots, slot-list snapshots and the allocator offered to spawned work come from resource, which
+            // must outlive the emitter and everything its slots spawned.
+            explicit emitter_impl(std::pmr::memory_resource* resource) noexcept {
+                (Use(static_cast<emitter_unit<Signals, Threading>*>(this), resource), ...);
+            }
+
+            emitter_impl(scope_group& group, std::pmr::memory_resource* resource) noexcept {
+                this->Join(group);
+                (Use(static_cast<emitter_unit<Signals, Threading>*>(this), resource), ...);
+            }
+
+            ~emitter_impl() {
+                // Timed emissions touch the emitter units, which are destroyed right after this body.
+                this->Cancel_timers();
+            }
+
+        private:
+            friend struct close_t;
+
+            template <typename Unit>
+            static void Use(Unit* unit, std::pmr::memory_resource* resource) noexcept {
+                unit->resource_ = resource;
+            }
+
+            bool Close() {
+                if (this->closed_.exchange(true, std::memory_order_acq_rel)) {
+                    return false;
+                }
+                this->Cancel_timers();
+                (static_cast<emitter_unit<Signals, Threading>*>(this)->Close_slots(), ...);
+                // A group's scope also runs the other members' work, which is theirs to stop.
+                if (this->spawn_ == &this->scope_) {
+                    this->scope_.request_stop();
+                }
+                return true;
+            }
+        };
+
+        // The arguments of enable_signal: signals, optionally led by a threading policy.
+        template <typename... Args>
+        inline constexpr bool emitter_arguments = (emittable<Args> && ...);
+
+        template <threading_policy Threading, typename... Args>
+        inline constexpr bool emitter_arguments<Threading, Args...> = (emittable<Args> && ...);
+
+        template <typename... Signals>
+        struct select_emitter {
+            using type = emitter_impl<multi_threaded, Signals...>;
+        };
+
+        template <threading_policy Threading, typename... Signals>
+        struct select_emitter<Threading, Signals...> {
+            using type = emitter_impl<Threading, Signals...>;
+        };
+
+        // Shuts an emitter down without blocking: from the call on it takes no emission and no connection,
+        // timers and slot policies stop, and work in its own scope is asked to stop. The returned sender
+        // completes once that scope is empty; a grouped emitter's work is awaited through its group.
+        struct close_t {
+            template <typename Threading, emittable...Signals>
+            auto operator()(emitter_impl<Threading, Signals...>* emitter) const {
+                emitter->Close();
+                return emitter->scope_.on_empty();
+            }
+
+            template <typename Threading, emittable...Signals>
+            auto operator()(emitter_impl<Threading, Signals...>& emitter) const {
+                return this->operator()(&emitter);
+            }
+        };
+
+        template <typename Receiver>
+        struct drain_operation_state : slot_control::drain_waiter {
+            template <stdexec::receiver Rcvr>
+            drain_operation_state(std::shared_ptr<slot_control>&& control, Rcvr&& rcvr)
+                : drain_waiter{&Complete}, control_(std::move(control)), rcvr_(std::forward<Rcvr>(rcvr)) {}
+
+            drain_operation_state(const drain_operation_state&)            = delete;
+            drain_operation_state& operator=(const drain_operation_state&) = delete;
+
+            // A placed slot first waits for the walks queued on its node, which may still spawn work into it.
+            friend void tag_invoke(stdexec::start_t, drain_operation_state& self) noexcept {
+                if (!self.control_) {
+                    stdexec::set_value(std::move(self.rcvr_));
+                }
+                else if (self.control_->upstream_) {
+                    self.control_->upstream_->Drain(&self);
+                }
+                else {
+                    self.control_->Drain(&self);
+                }
+            }
+
+        private:
+            static void Complete(drain_waiter* waiter) noexcept {
+                auto self = static_cast<drain_operation_state*>(waiter);
+                if (self->control_->upstream_ && !self->upstream_drained_) {
+                    self->upstream_drained_ = true;
+                    self->next_             = nullptr;
+                    self->control_->Drain(self);
+                    return;
+                }
+                stdexec::set_value(std::move(self->rcvr_));
+            }
+
+            std::shared_ptr<slot_control> control_;
+            Receiver                      rcvr_;
+            bool                          upstream_drained_ = false;
+        };
+
+        // Completes, on the thread that finishes the last of them, once the work a slot spawned
+        // before the drain started has completed. Work spawned later is not waited for.
+        struct drain_sender {
+            using sender_concept        = stdexec::sender_t;
+            using completion_signatures = stdexec::completion_signatures<stdexec::set_value_t()>;
+
+            template <stdexec::receiver Receiver>
+            friend auto tag_invoke(stdexec::connect_t, drain_sender&& self, Receiver&& rcvr) {
+                return drain_operation_state<std::decay_t<Receiver>>(std::move(self.control_), std::forward<Receiver>(rcvr));
+            }
+
+            std::shared_ptr<slot_control> control_;
+        };
+
+        // A slot's spawned work keeps it alive, so a connection that no longer reaches its slot has
+        // nothing left to wait for.
+        struct drain_t {
+            template <emittable Signal, typename SenderClosure, typename Threading>
+            drain_sender operator()(const connection_signatures<Signal, SenderClosure, Threading>& con) const {
+                auto slot = con.Share();
+                if (!slot || !slot->Control()) {
+                    return {nullptr};
+                }
+                return {std::shared_ptr<slot_control>(slot, slot->Control())};
+            }
+        };
+
+        template <emittable Signal, typename Emitter>
+        struct timed_emission : timed_emission_base {
+            timed_emission(timer_wheel::clock::duration period, const Signal& signal, Emitter* emitter)
+                : timed_emission_base(period), signal_(signal), emitter_(emitter) {}
+
+            void Emit() override {
+                emit_t{}(signal_, broadcast_t{}, emitter_);
+            }
+
+            Signal   signal_;
+            Emitter* emitter_;
+        };
+
+        class timer_handle {
+        public:
+            timer_handle() = default;
+
+            // Returns false if the emission already finished or was cancelled.
+            bool cancel() const {
+                auto emission = ptr_.lock();
+                return emission && emission->Cancel();
+            }
+
+            bool active() const noexcept {
+                auto emission = ptr_.lock();
+                return emission && !emission->done_.load(std::memory_order_acquire);
+            }
+
+        private:
+            template <bool Periodic>
+            friend struct emit_timed_t;
+
+            timer_handle(std::weak_ptr<timed_emission_base>&& ptr) : ptr_(std::move(ptr)) {}
+
+            std::weak_ptr<timed_emission_base> ptr_;
+        };
+
+        template <bool Periodic>
+        struct emit_timed_t {
+        public:
+            template <typename Rep, typename Period, emittable Signal, unit_of<Signal> Emitter>
+            timer_handle operator()(std::chrono::duration<Rep, Period> delay, const Signal& signal, broadcast_t, Emitter* emitter) const {
+                static_assert(!std::same_as<typename threading_of<Emitter>::type, single_threaded>,
+                    "Timed emissions broadcast from the timer dispatch thread; a single_threaded emitter stays on one thread.");
+                auto duration = std::chrono::duration_cast<timer_wheel::clock::duration>(delay);
+                auto emission = std::make_shared<timed_emission<Signal, Emitter>>(
+                    Periodic ? duration : timer_wheel::clock::duration::zero(), signal, emitter);
+                std::weak_ptr<timed_emission_base> handle = emission;
+                timed_emission_base* raw = emission.get();
+
+                emitter->Timers().Add(std::move(emission));
+                timer_wheel::shared().schedule(raw, duration);
+                return handle;
+            }
+
+            template <typename Rep, typename Period, emittable Signal, unit_of<Signal> Emitter>
+            timer_handle operator()(std::chrono::duration<Rep, Period> delay, const Signal& signal, broadcast_t, Emitter& emitter) const {
+                return this->operator()(delay, signal, broadcast_t{}, &emitter);
+            }
+        };
+
+        struct topic_hash {
+            using is_transparent = void;
+
+            std::size_t operator()(std::string_view topic) const noexcept {
+                return std::hash<std::string_view>{}(topic);
+            }
+        };
+
+        // Runtime topics for one signal type. Patterns are '.'-separated; '*' matches exactly one segment
+        // and '#' matches any number of segments. Subscriptions live in a trie, and each published topic
+        // is resolved once into a cached slot list, so a steady-state publish is one hash lookup plus the walk.
+        // The cache is split into copy-on-write shards: a miss copies one small shard, a full shard evicts
+        // one entry, and (un)subscribing only bumps a generation that marks older entries stale.
+        template <emittable Signal>
+        struct topic_unit {
+            using slot  = std::shared_ptr<slot_base<signal_degradation_t<Signal>>>;
+            using slots = std::vector<slot>;
+
+            struct cached {
+                std::shared_ptr<const slots> slots_;
+                std::uint64_t                generation_;
+            };
+
+            using shard = std::unordered_map<std::string, cached, topic_hash, std::equal_to<>>;
+
+            static constexpr std::size_t cache_shards     = 64;
+            static constexpr std::size_t max_shard_topics = 64;
+
+            topic_unit() = default;
+            ~topic_unit() {
+                std::lock_guard<std::shared_mutex> lock(mutex_);
+                for (auto& [slot_ptr, owner] : owners_) {
+                    slot_ptr->Close();
+                }
+            }
+
+        private:
+            friend struct subscribe_t<Signal>;
+            friend struct unsubscribe_t<Signal>;
+            friend struct publish_t;
+
+            struct node {
+                std::unordered_map<std::string, std::unique_ptr<node>, topic_hash, std::equal_to<>> children_;
+                std::unique_ptr<node> one_; // '*'
+                std::unique_ptr<node> any_; // '#'
+                slots                 slots_;
+                node*                 parent_ = nullptr;
+                std::string           segment_;
+
+                bool Empty() const noexcept {
+                    return slots_.empty() && children_.empty() && !one_ && !any_;
+                }
+            };
+
+            static std::vector<std::string_view> Split(std::string_view topic) {
+                std::vector<std::string_view> segments;
+                std::size_t begin = 0;
+                while (true) {
+                    std::size_t end = topic.find('.', begin);
+                    segments.push_back(topic.substr(begin, end == std::string_view::npos ? std::string_view::npos : end - begin));
+                    if (end == std::string_view::npos) {
+                        return segments;
+                    }
+                    begin = end + 1;
+                }
+            }
+
+            template <typename SenderClosure>
+            std::weak_ptr<slot_base<signal_degradation_t<Signal>>> Subscribe(std::string_view pattern, SenderClosure&& sender_closure) {
+                auto segments = Split(pattern);
+                if (std::find(segments.begin(), segments.end(), std::string_view{}) != segments.end()) {
+                    throw std::invalid_argument("Invalid topic pattern: empty segment.");
+                }
+
+                slot new_slot = std::make_shared<slot_impl<signal_degradation_t<Signal>, 
+                    std::decay_t<SenderClosure>>>(no_policy{}, std::forward<SenderClosure>(sender_closure));
+
+                std::lock_guard<std::shared_mutex> lock(mutex_);
+                node* current = &root_;
+                for (auto segment : segments) {
+                    std::unique_ptr<node>* child;
+                    if (segment == "*") {
+                        child = &current->one_;
+                    }
+                    else if (segment == "#") {
+                        child = &current->any_;
+                    }
+                    else {
+                        auto it = current->children_.find(segment);
+                        if (it == current->children_.end()) {
+                            it = current->children_.emplace(std::string(segment), nullptr).first;
+                        }
+                        child = &it->second;
+                    }
+                    if (!*child) {
+                        *child = std::make_unique<node>();
+                        (*child)->parent_  = current;
+                        (*child)->segment_ = segment;
+                    }
+                    current = child->get();
+                }
+                current->slots_.push_back(new_slot);
+                owners_.emplace(new_slot.get(), current);
+                generation_.fetch_add(1, std::memory_order_release);
+
+                return new_slot;
+            }
+
+            bool Unsubscribe(const slot& ptr) {
+                {
+                    std::lock_guard<std::shared_mutex> lock(mutex_);
+                    auto it = owners_.find(ptr.get());
+                    if (it == owners_.end()) {
+                        return false;
+                    }
+                    node* current = it->second;
+                    std::erase(current->slots_, ptr);
+                    owners_.erase(it);
+                    Prune(current);
+                    generation_.fetch_add(1, std::memory_order_release);
+                }
+                ptr->Close();
+                return true;
+            }
+
+            // Drops the now-empty tail of a pattern's path, so churning patterns do not grow the trie.
+            void Prune(node* current) {
+                while (current != &root_ && current->Empty()) {
+                    node* parent = current->parent_;
+                    if (current->segment_ == "*") {
+                        parent->one_.reset();
+                    }
+                    else if (current->segment_ == "#") {
+                        parent->any_.reset();
+                    }
+                    else {
+                        parent->children_.erase(current->segment_);
+                    }
+                    current = parent;
+                }
+            }
+
+            template <typename...Args>
+            void Publish(exec::async_scope* scope, std::string_view topic, const Args&...args) {
+                std::size_t   hash       = topic_hash{}(topic);
+                std::uint64_t generation = generation_.load(std::memory_order_acquire);
+                auto current = cache_[hash % cache_shards].load(std::memory_order_acquire);
+                std::shared_ptr<const slots> resolved;
+                const slots* targets = nullptr;
+
+                if (current) [[likely]] {
+                    auto it = current->find(topic);
+                    if (it != current->end() && it->second.generation_ == generation) {
+                        targets = it->second.slots_.get();
+                    }
+                }
+                if (!targets) [[unlikely]] {
+                    resolved = Resolve(topic, hash);
+                    targets  = resolved.get();
+                }
+
+                for (auto& slot_ptr : *targets) {
+                    slot_ptr->Invoke(scope, nullptr, args...);
+                }
+            }
+
+            std::shared_ptr<const slots> Resolve(std::string_view topic, std::size_t hash) {
+                auto segments = Split(topic);
+                auto resolved = std::make_shared<slots>();
+                std::unordered_set<const void*> seen;
+                std::uint64_t generation;
+                {
+                    std::shared_lock<std::shared_mutex> lock(mutex_);
+                    generation = generation_.load(std::memory_order_acquire);
+                    Collect(root_, segments, 0, *resolved, seen);
+                }
+
+                auto& bucket    = cache_[hash % cache_shards];
+                auto  old_shard = bucket.load(std::memory_order_acquire);
+                for (;;) {
+                    auto new_shard = old_shard ? std::make_shared<shard>(*old_shard) : std::make_shared<shard>();
+                    if (new_shard->size() >= max_shard_topics && !new_shard->contains(topic)) {
+                        auto victim = std::find_if(new_shard->begin(), new_shard->end(),
+                            [&](const auto& entry) { return entry.second.generation_ != generation; });
+                        new_shard->erase(victim != new_shard->end() ? victim : new_shard->begin());
+                    }
+                    new_shard->insert_or_assign(std::string(topic), cached{resolved, generation});
+                    if (bucket.compare_exchange_weak(old_shard, std::move(new_shard), std::memory_order_acq_rel)) {
+                        return resolved;
+                    }
+                }
+            }
+
+            static void Collect(const node& current, const std::vector<std::string_view>& segments, std::size_t i,
+                slots& out, std::unordered_set<const void*>& seen) {
+                if (current.any_) {
+                    for (std::size_t j = i; j <= segments.size(); j++) {
+                        Collect(*current.any_, segments, j, out, seen);
+                    }
+                }
+                if (i == segments.size()) {
+                    for (auto& slot_ptr : current.slots_) {
+                        if (seen.insert(slot_ptr.get()).second) {
+                            out.push_back(slot_ptr);
+                        }
+                    }
+                    return;
+                }
+                if (auto it = current.children_.find(segments[i]); it != current.children_.end()) {
+                    Collect(*it->second, segments, i + 1, out, seen);
+                }
+                if (current.one_) {
+                    Collect(*current.one_, segments, i + 1, out, seen);
+                }
+            }
+
+            std::atomic<std::shared_ptr<const shard>> cache_[cache_shards];
+            std::atomic<std::uint64_t>                generation_ = 0;
+            std::shared_mutex                         mutex_;
+            node                                      root_;
+            std::unordered_map<slot_base<signal_degradation_t<Signal>>*, node*> owners_;
+        };
+
+        template <emittable... Signals>
+        struct topic_bus_impl : topic_unit<Signals>..., virtual emitter_scope {
+            static_assert(sizeof...(Signals) > 0, "Topic bus should at least carry one kind of signal.");
+        };
+
+        // The compiler's spelling of T, inside that of this function. Separately built plugins agree on it
+        // only if they are built with the same compiler: the spelling differs between compilers.
+        template <typename T>
+        constexpr std::string_view type_name() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+            return __FUNCSIG__;
+#else
+            return __PRETTY_FUNCTION__;
+#endif
+        }
+
+        // FNV-1a of type_name<T>(). A bus key: it picks the cell, and the name settles a collision.
+        template <typename T>
+        consteval std::uint64_t type_name_hash() {
+            std::uint64_t hash = 14695981039346656037ull;
+            for (char c : type_name<T>()) {
+                hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+            }
+            return hash;
+        }
+
+        template <typename T>
+        inline constexpr std::uint64_t type_hash = type_name_hash<T>();
+
+        struct bus_node {
+            bus_node(std::uint64_t hash, std::string_view name) noexcept : hash_(hash), name_(name) {}
+            virtual ~bus_node() = default;
+
+            // Whether the node is the unit of T. The hash settles almost every probe; equal hashes compare
+            // names, the same literal in every translation unit that the linker merged.
+            template <typename T>
+            DAKING_ALWAYS_INLINE bool Holds() const noexcept {
+                constexpr std::string_view name = type_name<T>();
+                return hash_ == type_hash<T> && (name_.data() == name.data() || name_ == name);
+            }
+
+            const std::uint64_t    hash_;
+            const std::string_view name_;
+        };
+
+        template <emittable Signal>
+        struct bus_unit : bus_node, emitter_unit<Signal> {
+            bus_unit() : bus_node(type_hash<Signal>, type_name<Signal>()) {}
+        };
+
+        // Open-addressed cells that only ever go from empty to a published node. A type whose probe
+        // run is full lands in a linked successor twice the size, so no table is moved while the bus lives.
+        struct bus_table {
+            explicit bus_table(std::size_t capacity) : cells_(new std::atomic<bus_node*>[capacity]()), mask_(capacity - 1) {}
+            ~bus_table() {
+                for (std::size_t i = 0; i <= mask_; i++) {
+                    delete cells_[i].load(std::memory_order_acquire);
+                }
+                delete next_.load(std::memory_order_acquire);
+            }
+
+            std::unique_ptr<std::atomic<bus_node*>[]> cells_;
+            const std::size_t                         mask_;
+            std::atomic<bus_table*>                   next_ = nullptr;
+        };
+
+        // Signal types discovered at runtime: each gets its emitter_unit on first connect, and all of
+        // them spawn into the bus's one scope. A repeat lookup is one probe of the first table.
+        struct event_bus_impl : virtual emitter_scope {
+            static constexpr std::size_t initial_capacity = 64;
+            static constexpr std::size_t max_probe        = 8;
+
+            event_bus_impl()  = default;
+            ~event_bus_impl() = default;
+
+            explicit event_bus_impl(scope_group& group) noexcept {
+                this->Join(group);
+            }
+
+            event_bus_impl(const event_bus_impl&)            = delete;
+            event_bus_impl& operator=(const event_bus_impl&) = delete;
+
+            // Number of signal types that have a unit.
+            std::size_t signal_types() const noexcept {
+                return types_.load(std::memory_order_relaxed);
+            }
+
+        private:
+            template <emittable Signal>
+            friend struct connect_t;
+            template <emittable Signal>
+            friend struct disconnect_t;
+            friend struct emit_t;
+            friend struct publish_t;
+
+            template <emittable Signal>
+            DAKING_ALWAYS_INLINE emitter_unit<Signal>* Find() noexcept {
+                constexpr std::uint64_t hash = type_hash<Signal>;
+                for (bus_table* table = &first_; table; table = table->next_.load(std::memory_order_acquire)) {
+                    for (std::size_t i = 0; i < max_probe; i++) {
+                        bus_node* node = table->cells_[(hash + i) & table->mask_].load(std::memory_order_acquire);
+                        if (!node) {
+                            return nullptr; // Cells are never emptied, so no insert went past this one.
+                        }
+                        if (node->template Holds<Signal>()) [[likely]] {
+                            return static_cast<bus_unit<Signal>*>(node);
+                        }
+                    }
+                }
+                return nullptr;
+            }
+
+            template <emittable Signal>
+            emitter_unit<Signal>* Find_or_add() {
+                constexpr std::uint64_t hash = type_hash<Signal>;
+                std::unique_ptr<bus_unit<Signal>> fresh;
+                for (bus_table* table = &first_;;) {
+                    for (std::size_t i = 0; i < max_probe; i++) {
+                        auto& cell = table->cells_[(hash + i) & table->mask_];
+                        bus_node* node = cell.load(std::memory_order_acquire);
+                        if (!node) {
+                            if (!fresh) {
+                                fresh = std::make_unique<bus_unit<Signal>>();
+                            }
+                            if (cell.compare_exchange_strong(node, fresh.get(), std::memory_order_acq_rel, std::memory_order_acquire)) {
+                                types_.fetch_add(1, std::memory_order_relaxed);
+                                return fresh.release();
+                            }
+                        }
+                        if (node->template Holds<Signal>()) {
+                            return static_cast<bus_unit<Signal>*>(node); // Another thread added it first.
+                        }
+                    }
+
+                    bus_table* next = table->next_.load(std::memory_order_acquire);
+                    if (!next) {
+                        auto grown = new bus_table((table->mask_ + 1) * 2);
+                        if (table->next_.compare_exchange_strong(next, grown, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                            next = grown;
+                        }
+                        else {
+                            delete grown;
+                        }
+                    }
+                    table = next;
+                }
+            }
+
+            bus_table                first_{initial_capacity}; // Units close their slots with it, before the scope drains.
+            std::atomic<std::size_t> types_ = 0;
+        };
+
+        // Scopes that compact emitters spawn into instead of owning one each. Emitters are dealt out
+        // round-robin, so concurrent spawns spread over a few counters; the pool lives until exit.
+        struct scope_pool {
+            static constexpr std::size_t size = 8;
+
+            static scope_pool& shared() {
+                static scope_pool* pool = new scope_pool;
+                return *pool;
+            }
+
+            exec::async_scope* Pick() noexcept {
+                return &scopes_[next_.fetch_add(1, std::memory_order_relaxed) % size];
+            }
+
+            void Wait() {
+                for (auto& scope : scopes_) {
+                    stdexec::sync_wait(scope.on_empty());
+                }
+            }
+
+            exec::async_scope        scopes_[size];
+            std::atomic<std::size_t> next_ = 0;
+        };
+
+        // Marks a signal of a compact emitter, so the CPOs can tell which signals it carries.
+        template <emittable Signal>
+        struct compact_unit {};
+
+        template <emittable...Signals>
+        struct compact_table : emitter_unit<Signals>... {
+            explicit compact_table(exec::async_scope* scope) noexcept : scope_(scope) {}
+
+            exec::async_scope* scope_;
+        };
+
+        // One pointer per instance: the slot lists of all signals sit in a side table allocated on the
+        // first connect, and emissions spawn into a pooled scope or a scope_group. Destruction frees the table
+        // and does not wait, so spawned closures must not capture what dies with the emitter (join_compact_emitters()).
+        template <emittable...Signals>
+        struct compact_emitter_impl : compact_unit<Signals>... {
+            static_assert(sizeof...(Signals) > 0, "Emitter should at least emit one kind of signal.");
+
+            compact_emitter_impl() noexcept = default;
+
+            // Allocates the table up front, to spawn into the group rather than the shared pool.
+            explicit compact_emitter_impl(scope_group& group) : table_(new table(&group.scope_)) {}
+            ~compact_emitter_impl() {
+                delete table_.load(std::memory_order_acquire);
+            }
+
+            // Moving hands over the table, so connections stay valid; it must not race with other use.
+            compact_emitter_impl(compact_emitter_impl&& other) noexcept 
+                : table_(other.table_.exchange(nullptr, std::memory_order_acq_rel)) {}
+
+            compact_emitter_impl& operator=(compact_emitter_impl&& other) noexcept {
+                if (this != &other) {
+                    delete table_.exchange(other.table_.exchange(nullptr, std::memory_order_acq_rel), std::memory_order_acq_rel);
+                }
+                return *this;
+            }
+
+            // Bytes this instance occupies, its side table included.
+            std::size_t footprint() const noexcept {
+                return sizeof(*this) + (table_.load(std::memory_order_relaxed) ? sizeof(table) : 0);
+            }
+
+        private:
+            template <emittable Signal>
+            friend struct connect_t;
+            template <emittable Signal>
+            friend struct disconnect_t;
+            friend struct emit_t;
+            friend struct publish_t;
+
+            using table = compact_table<Signals...>;
+
+            template <emittable Signal>
+            DAKING_ALWAYS_INLINE emitter_unit<Signal>* Find() noexcept {
+                return table_.load(std::memory_order_acquire);
+            }
+
+            template <emittable Signal>
+            emitter_unit<Signal>* Find_or_add() {
+                table* current = table_.load(std::memory_order_acquire);
+                if (!current) [[unlikely]] {
+                    auto fresh = std::make_unique<table>(scope_pool::shared().Pick());
+                    if (table_.compare_exchange_strong(current, fresh.get(), std::memory_order_acq_rel, std::memory_order_acquire)) {
+                        current = fresh.release();
+                    }
+                }
+                return current;
+            }
+
+            // Only called once a unit was found, so the table exists.
+            DAKING_ALWAYS_INLINE exec::async_scope* Scope() noexcept {
+                return table_.load(std::memory_order_acquire)->scope_;
+            }
+
+            std::atomic<table*> table_ = nullptr;
+        };
+
+        inline void join_compact_emitters() {
+            scope_pool::shared().Wait();
+        }
+
+        // Inline buffer a fixed emitter reserves for each slot's closure by default.
+        inline constexpr std::size_t fixed_closure_bytes = 64;
+
+        // Completes an operation a fixed emitter runs on the emitting thread's stack. The waiter may return as
+        // soon as the second bump lands, so that bump is the receiver's last touch of the counter.
+        struct inline_receiver {
+            using receiver_concept = stdexec::receiver_t;
+
+            template <typename...Values>
+            void set_value(Values&&...) && noexcept {
+                Complete();
+            }
+
+            template <typename Error>
+            void set_error(Error&&) && noexcept {
+                Complete();
+            }
+
+            void set_stopped() && noexcept {
+                Complete();
+            }
+
+            void Complete() noexcept {
+                state_->fetch_add(1, std::memory_order_release);
+                state_->notify_one();
+                state_->fetch_add(1, std::memory_order_release);
+            }
+
+            std::atomic<std::uint32_t>* state_;
+        };
+
+        template <stdexec::sender Sender>
+        void run_inline(Sender&& sender) {
+            std::atomic<std::uint32_t> state = 0;
+            auto op = stdexec::connect(std::forward<Sender>(sender), inline_receiver{&state});
+            stdexec::start(op);
+            for (std::uint32_t seen; (seen = state.load(std::memory_order_acquire)) != 2;) {
+                if (seen == 0) {
+                    state.wait(0, std::memory_order_acquire);
+                }
+            }
+        }
+
+        // The lifecycle of a fixed slot, packed in one word so that claiming, toggling and retiring it are single
+        // atomic steps: a count of emits reading the closure, the generation handles check, and four flags.
+        // busy marks a closure being built or destroyed; the last emit out of a disconnected slot destroys it.
+        struct fixed_slot_state {
+            static constexpr std::uint64_t readers_mask     = 0xFFFF'FFFFull;
+            static constexpr int           generation_shift = 32;
+            static constexpr std::uint64_t generation_mask  = 0x0FFF'FFFFull << generation_shift;
+            static constexpr std::uint64_t enabled          = 1ull << 60;
+            static constexpr std::uint64_t live             = 1ull << 61;
+            static constexpr std::uint64_t used             = 1ull << 62;
+            static constexpr std::uint64_t busy             = 1ull << 63;
+
+            static std::uint32_t Generation(std::uint64_t state) noexcept {
+                return static_cast<std::uint32_t>((state & generation_mask) >> generation_shift);
+            }
+
+            bool Claim(std::uint32_t& generation) noexcept {
+                std::uint64_t state = guard_.load(std::memory_order_relaxed);
+                if ((state & ~generation_mask) != 0) {
+                    return false;
+                }
+                std::uint64_t next = ((state + (1ull << generation_shift)) & generation_mask) | used | busy;
+                if (!guard_.compare_exchange_strong(state, next, std::memory_order_acquire, std::memory_order_relaxed)) {
+                    return false;
+                }
+                generation = Generation(next);
+                return true;
+            }
+
+            void Publish() noexcept {
+                guard_.fetch_xor(busy | live | enabled, std::memory_order_release);
+            }
+
+            void Abandon() noexcept {
+                guard_.fetch_and(~(used | busy), std::memory_order_release);
+            }
+
+            DAKING_ALWAYS_INLINE bool Enter() noexcept {
+                if ((guard_.load(std::memory_order_relaxed) & (live | enabled)) != (live | enabled)) {
+                    return false;
+                }
+                if ((guard_.fetch_add(1, std::memory_order_acquire) & (live | enabled)) != (live | enabled)) [[unlikely]] {
+                    Leave();
+                    return false;
+                }
+                return true;
+            }
+
+            DAKING_ALWAYS_INLINE void Leave() noexcept {
+                std::uint64_t state = guard_.fetch_sub(1, std::memory_order_acq_rel) - 1;
+                if ((state & ~generation_mask) == used) [[unlikely]] {
+                    Retire(state);
+                }
+            }
+
+            bool Set_enabled(std::uint32_t generation, bool on) noexcept {
+                std::uint64_t state = guard_.load(std::memory_order_relaxed);
+                do {
+                    if (!(state & live) || Generation(state) != generation) {
+                        return false;
+                    }
+                } while (!guard_.compare_exchange_weak(state, on ? state | enabled : state & ~enabled, std::memory_order_relaxed));
+                return true;
+            }
+
+            bool Connected(std::uint32_t generation) const noexcept {
+                std::uint64_t state = guard_.load(std::memory_order_relaxed);
+                return (state & live) && Generation(state) == generation;
+            }
+
+            bool Disconnect(std::uint32_t generation) noexcept {
+                std::uint64_t state = guard_.load(std::memory_order_relaxed);
+                std::uint64_t next;
+                do {
+                    if (!(state & live) || Generation(state) != generation) {
+                        return false;
+                    }
+                    next = state & ~(live | enabled);
+                } while (!guard_.compare_exchange_weak(state, next, std::memory_order_acq_rel, std::memory_order_relaxed));
+                if ((next & ~generation_mask) == used) {
+                    Retire(next);
+                }
+                return true;
+            }
+
+            // Several parties may see the slot idle at once; the one whose exchange lands destroys the closure.
+            void Retire(std::uint64_t state) noexcept {
+                if (guard_.compare_exchange_strong(state, state | busy, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                    destroy_(this);
+                    guard_.fetch_and(~(used | busy), std::memory_order_release);
+                }
+            }
+
+            std::atomic<std::uint64_t> guard_ = 0;
+            void (*destroy_)(fixed_slot_state*) noexcept = nullptr;
+        };
+
+        template <typename Signal>
+        struct fixed_invoker;
+
+        template <signal_arg...Args>
+        struct fixed_invoker<signal<Args...>> {
+            using type = void (*)(const void*, const Args&...);
+        };
+
+        template <>
+        struct fixed_invoker<signal<void>> {
+            using type = void (*)(const void*);
+        };
+
+        template <typename Signal, std::size_t Bytes>
+        struct fixed_slot : fixed_slot_state {
+            typename fixed_invoker<Signal>::type invoke_ = nullptr;
+            alignas(std::max_align_t) std::byte  storage_[Bytes];
+        };
+
+        template <typename Signal, typename SenderClosure>
+        struct fixed_thunk;
+
+        template <typename...Args, typename SenderClosure>
+            requires (!signal<Args...>::is_void_signal)
+        struct fixed_thunk<signal<Args...>, SenderClosure> {
+            static void Invoke(const void* storage, const Args&...args) {
+                run_inline(stdexec::just(args...) | *static_cast<const SenderClosure*>(storage));
+            }
+        };
+
+        template <stdexec::sender Sender>
+        struct fixed_thunk<signal<void>, Sender> {
+            static void Invoke(const void* storage) {
+                run_inline(*static_cast<const Sender*>(storage));
+            }
+        };
+
+        // The slot table of a fixed emitter: Capacity slots embedded in the emitter, each holding its closure in
+        // an inline buffer. Connect claims a free slot and emit runs the enabled ones inline, so neither allocates;
+        // only the copy of the arguments each slot receives can, when copying an argument allocates.
+        // Emits, connects and disconnects may come from any thread.
+        template <emittable Signal, std::size_t Capacity, std::size_t Bytes>
+        struct fixed_unit {
+            using slot = fixed_slot<signal_degradation_t<Signal>, Bytes>;
+
+            fixed_unit() = default;
+            ~fixed_unit() {
+                for (slot& slot_ref : slots_) {
+                    if (slot_ref.guard_.load(std::memory_order_acquire) & fixed_slot_state::used) {
+                        slot_ref.destroy_(&slot_ref);
+                    }
+                }
+            }
+
+            fixed_unit(const fixed_unit&)            = delete;
+            fixed_unit& operator=(const fixed_unit&) = delete;
+
+        private:
+            friend struct connect_t<Signal>;
+            friend struct disconnect_t<Signal>;
+            friend struct emit_t;
+
+            template <typename SenderClosure>
+            fixed_connection<Signal> Register(SenderClosure&& sender_closure) {
+                using closure_type = std::decay_t<SenderClosure>;
+                static_assert(sizeof(closure_type) <= Bytes && alignof(closure_type) <= alignof(std::max_align_t),
+                    "The closure does not fit the inline buffer of a fixed emitter slot.");
+
+                for (slot& slot_ref : slots_) {
+                    std::uint32_t generation;
+                    if (slot_ref.Claim(generation)) {
+                        try {
+                            ::new (static_cast<void*>(slot_ref.storage_)) closure_type(std::forward<SenderClosure>(sender_closure));
+                        }
+                        catch (...) {
+                            slot_ref.Abandon();
+                            throw;
+                        }
+                        slot_ref.invoke_  = &fixed_thunk<signal_degradation_t<Signal>, closure_type>::Invoke;
+                        slot_ref.destroy_ = &Destroy<closure_type>;
+                        slot_ref.Publish();
+                        return fixed_connection<Signal>(&slot_ref, generation);
+                    }
+                }
+                return fixed_connection<Signal>();
+            }
+
+            bool Unregister(const fixed_connection<Signal>& con) noexcept {
+                std::less_equal<const fixed_slot_state*> before;
+                if (!con.slot_ || !before(&slots_.front(), con.slot_) || !before(con.slot_, &slots_.back())) {
+                    return false;
+                }
+                return con.slot_->Disconnect(con.generation_);
+            }
+
+            template <typename...Args>
+            DAKING_ALWAYS_INLINE void Broadcast(const Args&... args) {
+                for (slot& slot_ref : slots_) {
+                    if (slot_ref.Enter()) {
+                        slot_ref.invoke_(slot_ref.storage_, args...);
+                        slot_ref.Leave();
+                    }
+                }
+            }
+
+            template <typename Closure>
+            static void Destroy(fixed_slot_state* state) noexcept {
+                std::launder(reinterpret_cast<Closure*>(static_cast<slot*>(state)->storage_))->~Closure();
+            }
+
+            std::array<slot, Capacity> slots_;
+        };
+
+        // Handle to a fixed slot: its address and the generation it was claimed in, so a handle to a slot freed
+        // and claimed again reports disconnected. A failed connect returns a default one. It must not outlive
+        // its emitter.
+        template <emittable Signal>
+        struct fixed_connection {
+            fixed_connection() = default;
+
+            DAKING_ALWAYS_INLINE bool enable() const noexcept {
+                return slot_ && slot_->Set_enabled(generation_, true);
+            }
+
+            DAKING_ALWAYS_INLINE bool disable() const noexcept {
+                return slot_ && slot_->Set_enabled(generation_, false);
+            }
+
+            DAKING_ALWAYS_INLINE bool connected() const noexcept {
+                return slot_ && slot_->Connected(generation_);
+            }
+
+        private:
+            template <emittable, std::size_t, std::size_t>
+            friend struct fixed_unit;
+
+            fixed_connection(fixed_slot_state* slot, std::uint32_t generation) noexcept : slot_(slot), generation_(generation) {}
+
+            fixed_slot_state* slot_       = nullptr;
+            std::uint32_t     generation_ = 0;
+        };
+
+        // An emitter whose slots live in the object: Capacity per signal, closures of up to Bytes each. Slots
+        // run on the emitting thread instead of a scope; a closure that hops to a scheduler keeps the emit
+        // waiting until it completes. It takes plain closures only.
+        template <std::size_t Capacity, std::size_t Bytes, emittable...Signals>
+        struct fixed_emitter_impl : fixed_unit<Signals, Capacity, Bytes>... {
+            static_assert(sizeof...(Signals) > 0, "Emitter should at least emit one kind of signal.");
+            static_assert(Capacity > 0, "A fixed emitter needs room for at least one slot.");
+
+            static constexpr std::size_t slot_capacity = Capacity;
+            static constexpr std::size_t closure_bytes = Bytes;
+        };
+
+        template <emittable Signal>
+        struct subscribe_t {
+        public:
+            template <std::derived_from<topic_unit<Signal>> B, typename SenderClosure>
+                requires (std::derived_from<B, emitter_scope> && std::copy_constructible<SenderClosure> &&
+                    (!Signal::is_void_signal && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>>
+                    || Signal::is_void_signal && stdexec::sender<SenderClosure>))
+            connection_signatures<Signal, SenderClosure> operator()(B* bus, std::string_view pattern, SenderClosure&& sender_closure) const {
+                topic_unit<Signal>* unit = bus;
+                return {unit->Subscribe(pattern, std::forward<SenderClosure>(sender_closure)), bus->Scope()};
+            }
+
+            template <std::derived_from<topic_unit<Signal>> B, typename SenderClosure>
+                requires (std::derived_from<B, emitter_scope> && std::copy_constructible<SenderClosure> &&
+                    (!Signal::is_void_signal && std::derived_from<SenderClosure, stdexec::sender_adaptor_closure<SenderClosure>>
+                    || Signal::is_void_signal && stdexec::sender<SenderClosure>))
+            connection_signatures<Signal, SenderClosure> operator()(B& bus, std::string_view pattern, SenderClosure&& sender_closure) const {
+                return this->operator()(&bus, pattern, std::forward<SenderClosure>(sender_closure));
+            }
+        };
+
+        template <emittable Signal>
+        struct unsubscribe_t {
+        public:
+            template <typename SenderClosure>
+            bool operator()(topic_unit<Signal>* bus, connection_signatures<Signal, SenderClosure>& con) const {
+                auto slot = con.Share();
+                return slot && bus->Unsubscribe(slot);
+            }
+
+            template <typename SenderClosure>
+            bool operator()(topic_unit<Signal>& bus, connection_signatures<Signal, SenderClosure>& con) const {
+                return this->operator()(&bus, con);
+            }
+        };
+
+        struct publish_t {
+        public:
+            template <emittable Signal, std::derived_from<topic_unit<Signal>> B>
+                requires std::derived_from<B, emitter_scope>
+            DAKING_ALWAYS_INLINE void operator()(const Signal& signal, std::string_view topic, B* bus) const {
+                topic_unit<Signal>* unit = bus;
+                if constexpr (Signal::is_void_signal) {
+                    unit->Publish(bus->Scope(), topic);
+                }
+                else {
+                    std::apply([&](const auto&...args) {
+                        unit->Publish(bus->Scope(), topic, args...);
+                    }, signal.args_);
+                }
+            }
+
+            template <emittable Signal, std::derived_from<topic_unit<Signal>> B>
+                requires std::derived_from<B, emitter_scope>
+            DAKING_ALWAYS_INLINE void operator()(const Signal& signal, std::string_view topic, B& bus) const {
+                this->operator()(signal, topic, &bus);
+            }
+
+            // A type nobody has connected to has no unit yet, and publishing it allocates nothing.
+            template <emittable Signal, std::derived_from<event_bus_impl> B>
+            DAKING_ALWAYS_INLINE void operator()(const Signal& signal, B* bus) const {
+                emitter_unit<Signal>* unit = bus->template Find<Signal>();
+                if (unit) [[likely]] {
+                    if constexpr (Signal::is_void_signal) {
+                        unit->Broadcast(bus->Scope());
+                    }
+                    else {
+                        std::apply([&](const auto&...args) {
+                            unit->Broadcast(bus->Scope(), args...);
+                        }, signal.args_);
+                    }
+                }
+            }
+
+            template <emittable Signal, std::derived_from<event_bus_impl> B>
+            DAKING_ALWAYS_INLINE void operator()(const Signal& signal, B& bus) const {
+                this->operator()(signal, &bus);
+            }
+        };
+    }
+
+    using detail::signal;
+    using detail::keyed_signal;
+    using detail::ring_signal;
+    using detail::combining_signal;
+    using detail::emittable;
+    using detail::emitter;
+    using detail::connection;
+    using detail::connection_policy;
+    using detail::throttle;
+    using detail::debounce;
+    using detail::filter;
+    using detail::timer_handle;
+    using detail::consumer_group;
+    using detail::numa_topology;
+    using detail::numa_domain;
+    using detail::numa_local;
+
+    template <emittable Signal>
+    inline constexpr detail::connect_t<Signal> connect;
+    template <emittable Signal>
+    inline constexpr detail::connect_if_t<Signal> connect_if;
+    template <emittable Signal>
+    inline constexpr detail::disconnect_t<Signal> disconnect;
+    template <std::size_t I>
+    inline constexpr detail::arg_equals_t<I> arg_equals;
+
+    template <std::size_t I>
+    inline constexpr detail::partition_by_t<I> partition_by;
+    inline constexpr detail::round_robin_t     round_robin;
+    inline constexpr detail::least_loaded_t    least_loaded;
 
     inline constexpr detail::emit_t      emit;
     inline constexpr detail::broadcast_t broadcast;
     inline constexpr detail::capture_t   capture;
 
+    inline constexpr detail::close_t close;
+
+    inline constexpr detail::drain_t drain;
+
+    inline constexpr detail::emit_timed_t<false> emit_after;
+    inline constexpr detail::emit_timed_t<true>  emit_every;
+
+    // enable_signal<Signals...> is safe to use from any thread; enable_signal<single_threaded, Signals...>
+    // drops the atomics for emitters that never leave one thread. Every other argument must be a signal.
+    template <typename... Signals>
+        requires detail::emitter_arguments<Signals...>
+    using enable_signal = typename detail::select_emitter<Signals...>::type;
+
+    using detail::multi_threaded;
+    using detail::single_threaded;
+
+    // fixed_emitter<Capacity, Signals...> embeds Capacity slots per signal and runs them inline on the
+    // emitting thread: connect, disconnect and emit never allocate, apart from copying arguments that allocate
+    // when copied. basic_fixed_emitter sets the inline buffer each closure gets.
+    template <std::size_t Capacity, std::size_t ClosureBytes, emittable... Signals>
+    using basic_fixed_emitter = detail::fixed_emitter_impl<Capacity, ClosureBytes, Signals...>;
+
+    template <std::size_t Capacity, emittable... Signals>
+    using fixed_emitter = detail::fixed_emitter_impl<Capacity, detail::fixed_closure_bytes, Signals...>;
+
+    using detail::fixed_connection;
+
+    template <emittable Signal>
+    inline constexpr detail::subscribe_t<Signal> subscribe;
+    template <emittable Signal>
+    inline constexpr detail::unsubscribe_t<Signal> unsubscribe;
+
+    inline constexpr detail::publish_t publish;
+
+    template <emittable... Signals>
+    using topic_bus = detail::topic_bus_impl<Signals...>;
+
+    using event_bus = detail::event_bus_impl;
+
+    using detail::scope_group;
+
     template <emittable... Signals>
-    using enable_signal = detail::emitter_impl<Signals...>;
+    using compact_emitter = detail::compact_emitter_impl<Signals...>;
+
+    // Blocks until everything compact emitters have spawned so far has finished; for shutdown.
+    using detail::join_compact_emitters;
 }
 
 #endif // !DAKING_SIGNAL_HPP
\ No newline at end of file
@@ -0,0 +1,330 @@
+/*
+MIT License
+
+Copyright (c) 2026 dakingffo
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#if defined(_MSC_VER) && _MSC_VER > 1000 || defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 3)
+#pragma once
+#endif
+
+#ifndef DAKING_SIGNAL_ARENA_HPP
+#define DAKING_SIGNAL_ARENA_HPP
+
+#include "signal.hpp"
+
+#if defined(__linux__)
+
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <memory_resource>
+#include <system_error>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace daking {
+    namespace detail {
+        inline constexpr std::size_t huge_page_bytes = std::size_t(1) << 21;
+
+        // Requests this large get mappings of their own, returned on deallocate; smaller ones are carved from
+        // shared regions that live as long as the arena, the way a pool resource uses its upstream.
+        inline constexpr std::size_t huge_page_direct = huge_page_bytes / 2;
+
+        inline constexpr int max_numa_nodes = 1024;
+
+        // Prefers node for the pages of a range not yet touched, through the raw syscall so that libnuma is not
+        // needed. Best effort: a kernel without NUMA support leaves placement to first touch.
+        inline bool prefer_node(void* data, std::size_t size, int node) noexcept {
+#if defined(SYS_mbind)
+            constexpr std::size_t word_bits = sizeof(unsigned long) * CHAR_BIT;
+            constexpr int         mpol_preferred = 1;
+            if (node < 0 || node >= max_numa_nodes) {
+                return false;
+            }
+            unsigned long mask[max_numa_nodes / word_bits] = {};
+            mask[node / word_bits] |= 1ul << (node % word_bits);
+            return ::syscall(SYS_mbind, data, size, mpol_preferred, mask, max_numa_nodes, 0) == 0;
+#else
+            return false;
+#endif
+        }
+
+        // The node the calling thread runs on, or 0 where the kernel does not say.
+        inline int current_node() noexcept {
+#if defined(SYS_getcpu)
+            unsigned cpu = 0, node = 0;
+            if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+                return static_cast<int>(node);
+            }
+#endif
+            return 0;
+        }
+
+        // One past the highest online node, read from sysfs ("0-1,3"); 1 when it cannot be read.
+        inline int online_nodes() {
+            std::ifstream online("/sys/devices/system/node/online");
+            std::string   ranges;
+            if (!(online >> ranges)) {
+                return 1;
+            }
+            int highest = 0;
+            for (std::size_t i = 0; i < ranges.size();) {
+                std::size_t end = ranges.find_first_of(",-", i);
+                int value = std::atoi(ranges.substr(i, end - i).c_str());
+                highest = std::max(highest, value);
+                i = end == std::string::npos ? ranges.size() : end + 1;
+            }
+            return std::min(highest + 1, max_numa_nodes);
+        }
+
+        enum class page_backing { transparent, hugetlb, normal };
+
+        // madvise accepts MADV_HUGEPAGE even when THP is switched off, so ask sysfs whether it would act on it.
+        inline bool transparent_huge_pages() {
+            static const bool enabled = [] {
+                std::ifstream mode("/sys/kernel/mm/transparent_hugepage/enabled");
+                std::string   line;
+                return std::getline(mode, line) && line.find("[never]") == std::string::npos;
+            }();
+            return enabled;
+        }
+
+        // Maps whole 2 MiB pages, 2 MiB aligned: transparent huge pages through madvise first, the hugetlb
+        // pool when THP is disabled, and normal pages when neither is available.
+        struct huge_mapping {
+            static huge_mapping Map(std::size_t size, int node) {
+                size = (size + huge_page_bytes - 1) / huge_page_bytes * huge_page_bytes;
+
+                void* raw = ::mmap(nullptr, size + huge_page_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (raw == MAP_FAILED) {
+                    throw std::system_error(errno, std::generic_category(), "mmap(huge page arena)");
+                }
+                auto begin   = reinterpret_cast<std::uintptr_t>(raw);
+                auto aligned = (begin + huge_page_bytes - 1) / huge_page_bytes * huge_page_bytes;
+                if (aligned != begin) {
+                    ::munmap(raw, aligned - begin);
+                }
+                ::munmap(reinterpret_cast<void*>(aligned + size), begin + huge_page_bytes - aligned);
+                void* data = reinterpret_cast<void*>(aligned);
+
+                page_backing backing = page_backing::transparent;
+#if defined(MADV_HUGEPAGE)
+                if (!transparent_huge_pages() || ::madvise(data, size, MADV_HUGEPAGE) != 0)
+#endif
+                {
+                    backing = page_backing::normal;
+#if defined(MAP_HUGETLB)
+                    void* pinned = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                    if (pinned != MAP_FAILED) {
+                        ::munmap(data, size);
+                        data    = pinned;
+                        backing = page_backing::hugetlb;
+                    }
+#endif
+                }
+                if (node >= 0) {
+                    prefer_node(data, size, node);
+                }
+                return {data, size, backing};
+            }
+
+            void Unmap() noexcept {
+                ::munmap(data_, size_);
+            }
+
+            void*        data_;
+            std::size_t  size_;
+            page_backing backing_;
+        };
+
+        // Upstream of a huge page arena: carves small requests from shared regions, bump style, and maps large
+        // ones on their own. Thread-safe, since a synchronized pool may refill several thread pools at once.
+        class huge_page_chunks : public std::pmr::memory_resource {
+        public:
+            huge_page_chunks(int node, std::size_t region_bytes) noexcept : node_(node), region_bytes_(region_bytes) {}
+
+            huge_page_chunks(const huge_page_chunks&)            = delete;
+            huge_page_chunks& operator=(const huge_page_chunks&) = delete;
+
+            ~huge_page_chunks() {
+                for (auto& region : regions_) {
+                    region.Unmap();
+                }
+                for (auto& [data, mapping] : direct_) {
+                    mapping.Unmap();
+                }
+            }
+
+            std::size_t Mapped_bytes() const noexcept {
+                return mapped_.load(std::memory_order_relaxed);
+            }
+
+            std::size_t Huge_bytes() const noexcept {
+                return huge_.load(std::memory_order_relaxed);
+            }
+
+        private:
+            void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (bytes >= huge_page_direct) {
+                    huge_mapping mapping = Track(huge_mapping::Map(bytes, node_));
+                    direct_.emplace(mapping.data_, mapping);
+                    return mapping.data_;
+                }
+
+                std::size_t offset = (used_ + alignment - 1) / alignment * alignment;
+                if (regions_.empty() || offset + bytes > regions_.back().size_) {
+                    regions_.push_back(Track(huge_mapping::Map(region_bytes_, node_)));
+                    offset = 0;
+                }
+                used_ = offset + bytes;
+                return static_cast<std::byte*>(regions_.back().data_) + offset;
+            }
+
+            // Carved memory goes back with the regions; only mappings of their own are returned early. A pointer
+            // this arena never mapped, or one already returned, is left alone rather than unmapped twice.
+            void do_deallocate(void* ptr, std::size_t bytes, std::size_t) override {
+                if (bytes >= huge_page_direct) {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    auto found = direct_.find(ptr);
+                    if (found == direct_.end()) {
+                        return;
+                    }
+                    huge_mapping mapping = found->second;
+                    direct_.erase(found);
+                    mapped_.fetch_sub(mapping.size_, std::memory_order_relaxed);
+                    huge_.fetch_sub(mapping.backing_ == page_backing::normal ? 0 : mapping.size_, std::memory_order_relaxed);
+                    mapping.Unmap();
+                }
+            }
+
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+                return this == &other;
+            }
+
+            huge_mapping Track(huge_mapping mapping) noexcept {
+                mapped_.fetch_add(mapping.size_, std::memory_order_relaxed);
+                huge_.fetch_add(mapping.backing_ == page_backing::normal ? 0 : mapping.size_, std::memory_order_relaxed);
+                return mapping;
+            }
+
+            int                                       node_;
+            std::size_t                               region_bytes_;
+            std::mutex                                mutex_;
+            std::vector<huge_mapping>                 regions_;
+            std::unordered_map<void*, huge_mapping>   direct_;
+            std::size_t                               used_   = 0;
+            std::atomic<std::size_t>                  mapped_ = 0;
+            std::atomic<std::size_t>                  huge_   = 0;
+        };
+    }
+
+    using detail::page_backing;
+
+    // A memory resource over 2 MiB huge pages, for emitters whose broadcast loops walk more slots than the
+    // dTLB covers: pass it to an emitter and its slots, slot-list snapshots and consumer lists share a few
+    // huge pages instead of scattering over the heap's 4 KiB ones. Freed blocks are pooled by size and
+    // reused; the pages themselves are returned when the arena is destroyed, except blocks of 1 MiB and
+    // more, which get mappings of their own. A node of -1 leaves placement to first touch.
+    class huge_page_arena : public std::pmr::memory_resource {
+    public:
+        explicit huge_page_arena(int node = -1, std::size_t region_bytes = 8 * detail::huge_page_bytes)
+            : chunks_(node, region_bytes), pool_(Options(), &chunks_), node_(node) {}
+
+        huge_page_arena(const huge_page_arena&)            = delete;
+        huge_page_arena& operator=(const huge_page_arena&) = delete;
+
+        int node() const noexcept {
+            return node_;
+        }
+
+        // Bytes mapped so far, and how many of them the kernel was asked to back with huge pages.
+        std::size_t mapped_bytes() const noexcept {
+            return chunks_.Mapped_bytes();
+        }
+
+        std::size_t huge_bytes() const noexcept {
+            return chunks_.Huge_bytes();
+        }
+
+    private:
+        static std::pmr::pool_options Options() noexcept {
+            std::pmr::pool_options options;
+            options.largest_required_pool_block = detail::huge_page_direct - 1;
+            return options;
+        }
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+            return pool_.allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override {
+            pool_.deallocate(ptr, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+
+        detail::huge_page_chunks             chunks_;
+        std::pmr::synchronized_pool_resource pool_;
+        int                                  node_;
+    };
+
+    // One huge page arena per online NUMA node, found through sysfs. local() is the arena of the node the
+    // calling thread runs on, for an emitter constructed where its slots will be walked.
+    class numa_arenas {
+    public:
+        explicit numa_arenas(std::size_t region_bytes = 8 * detail::huge_page_bytes) {
+            int nodes = detail::online_nodes();
+            arenas_.reserve(nodes);
+            for (int node = 0; node < nodes; node++) {
+                arenas_.push_back(std::make_unique<huge_page_arena>(node, region_bytes));
+            }
+        }
+
+        std::size_t nodes() const noexcept {
+            return arenas_.size();
+        }
+
+        huge_page_arena& for_node(int node) {
+            if (node < 0 || static_cast<std::size_t>(node) >= arenas_.size()) {
+                throw std::out_of_range("Can't find the arena: no such NUMA node.");
+            }
+            return *arenas_[node];
+        }
+
+        huge_page_arena& local() {
+            int node = detail::current_node();
+            return *arenas_[static_cast<std::size_t>(node) < arenas_.size() ? node : 0];
+        }
+
+    private:
+        std::vector<std::unique_ptr<huge_page_arena>> arenas_;
+    };
+}
+
+#endif // __linux__
+
+#endif // !DAKING_SIGNAL_ARENA_HPP
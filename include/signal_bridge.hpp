@@ -0,0 +1,560 @@
+/*
+MIT License
+
+Copyright (c) 2026 dakingffo
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#if defined(_MSC_VER) && _MSC_VER > 1000 || defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 3)
+#pragma once
+#endif
+
+#ifndef DAKING_SIGNAL_BRIDGE_HPP
+#define DAKING_SIGNAL_BRIDGE_HPP
+#include "signal_codec.hpp"
+
+#if defined(__linux__)
+
+#include <cerrno>
+#include <system_error>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace daking {
+    namespace detail {
+        inline constexpr std::uint32_t bridge_hello  = 1; // receiver -> sender: initial window and signal list
+        inline constexpr std::uint32_t bridge_data   = 2; // sender -> receiver: count frames
+        inline constexpr std::uint32_t bridge_credit = 3; // receiver -> sender: count more frames may be sent
+
+        inline constexpr std::size_t bridge_max_packet = 64 << 10;
+        inline constexpr std::size_t bridge_batch      = 16; // packets per recvmmsg
+
+        struct bridge_packet {
+            std::uint32_t kind_;
+            std::uint32_t count_;
+            std::uint64_t signature_;
+        };
+
+        struct bridge_frame {
+            std::uint32_t signal_; // position in the bridge's signal list
+            std::uint32_t size_;   // codec bytes that follow
+        };
+
+        inline constexpr std::size_t bridge_max_frame = bridge_max_packet - sizeof(bridge_packet);
+
+        inline sockaddr_un bridge_address(const std::string& path) {
+            sockaddr_un address{};
+            address.sun_family = AF_UNIX;
+            if (path.size() >= sizeof(address.sun_path)) {
+                throw std::invalid_argument("Unix socket path is too long: " + path);
+            }
+            std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+            return address;
+        }
+
+        inline bool bridge_send(int fd, const bridge_packet& packet) noexcept {
+            ssize_t result;
+            do {
+                result = ::send(fd, &packet, sizeof(packet), MSG_NOSIGNAL);
+            } while (result < 0 && errno == EINTR);
+            return result == static_cast<ssize_t>(sizeof(packet));
+        }
+
+        // Reads one control packet; false once the peer is gone or sent something else.
+        inline bool bridge_receive(int fd, bridge_packet& packet, int flags) noexcept {
+            ssize_t result;
+            do {
+                result = ::recv(fd, &packet, sizeof(packet), flags);
+            } while (result < 0 && errno == EINTR);
+            return result == static_cast<ssize_t>(sizeof(packet));
+        }
+    }
+
+    // A connected SOCK_SEQPACKET Unix domain socket: reliable, ordered, and message boundaries are kept.
+    class seqpacket_socket {
+    public:
+        static seqpacket_socket connect(const std::string& path) {
+            seqpacket_socket socket(Open());
+            auto address = detail::bridge_address(path);
+            if (::connect(socket.fd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+                throw std::system_error(errno, std::generic_category(), "connect(" + path + ")");
+            }
+            return socket;
+        }
+
+        // Both ends of an anonymous connection, for bridging within one process or across a fork.
+        static std::pair<seqpacket_socket, seqpacket_socket> pair() {
+            int fds[2];
+            if (::socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, fds) != 0) {
+                throw std::system_error(errno, std::generic_category(), "socketpair");
+            }
+            return {seqpacket_socket(fds[0]), seqpacket_socket(fds[1])};
+        }
+
+        explicit seqpacket_socket(int fd) noexcept : fd_(fd) {}
+        seqpacket_socket(seqpacket_socket&& other) noexcept : fd_(std::exchange(other.fd_, -1)) {}
+        seqpacket_socket& operator=(seqpacket_socket&&) = delete;
+
+        ~seqpacket_socket() {
+            if (fd_ >= 0) {
+                ::close(fd_);
+            }
+        }
+
+        int native_handle() const noexcept { return fd_; }
+
+    private:
+        friend class seqpacket_listener;
+
+        static int Open() {
+            int fd = ::socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+            if (fd < 0) {
+                throw std::system_error(errno, std::generic_category(), "socket");
+            }
+            return fd;
+        }
+
+        int fd_ = -1;
+    };
+
+    // Listens on a filesystem path, replacing a stale socket file; the path is removed on destruction.
+    class seqpacket_listener {
+    public:
+        explicit seqpacket_listener(std::string path) : socket_(seqpacket_socket::Open()), path_(std::move(path)) {
+            auto address = detail::bridge_address(path_);
+            ::unlink(path_.c_str());
+            if (::bind(socket_.fd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0
+                || ::listen(socket_.fd_, 8) != 0) {
+                throw std::system_error(errno, std::generic_category(), "bind(" + path_ + ")");
+            }
+        }
+
+        ~seqpacket_listener() {
+            ::unlink(path_.c_str());
+        }
+
+        seqpacket_socket accept() {
+            int fd;
+            do {
+                fd = ::accept4(socket_.fd_, nullptr, nullptr, SOCK_CLOEXEC);
+            } while (fd < 0 && errno == EINTR);
+            if (fd < 0) {
+                throw std::system_error(errno, std::generic_category(), "accept(" + path_ + ")");
+            }
+            return seqpacket_socket(fd);
+        }
+
+    private:
+        seqpacket_socket socket_;
+        std::string      path_;
+    };
+
+    namespace detail {
+        // State shared by a bridge_sender and the slots it connects. Slots encode frames into a staging
+        // buffer; the writer thread swaps it out and sends it as packets of many frames, each a gather
+        // write of the packet header and the frames, never more frames than the receiver has granted.
+        template <emittable...Signals>
+        class bridge_sender_core {
+        public:
+            bridge_sender_core(seqpacket_socket socket, std::size_t max_pending, std::chrono::milliseconds linger)
+                : socket_(std::move(socket)), max_pending_(max_pending), linger_(linger) {
+                bridge_packet hello{};
+                if (!bridge_receive(socket_.native_handle(), hello, 0) || hello.kind_ != bridge_hello) {
+                    throw std::runtime_error("Can't bridge signals: the peer did not answer.");
+                }
+                if (hello.signature_ != codec_signature<Signals...>) {
+                    throw std::runtime_error("Can't bridge signals: the peer expects a different signal list.");
+                }
+                credits_ = hello.count_;
+                writer_  = std::thread([this] { Run(); });
+            }
+
+            ~bridge_sender_core() {
+                Close();
+            }
+
+            // Blocks while max_pending frames are waiting for credit, so a slow receiver slows the emitter.
+            // A frame that cannot be staged, because the bridge closed or failed or memory ran out, is dropped.
+            template <std::size_t I, typename...Args>
+            void Stage(const Args&...args) noexcept {
+                using fields = typename signal_fields<signal_degradation_t<std::tuple_element_t<I, std::tuple<Signals...>>>>::type;
+
+                inflight_.fetch_add(1, std::memory_order_seq_cst);
+                std::size_t payload = fields::Size_of_args(args...);
+                bool        staged  = false;
+                if (!closed_.load(std::memory_order_seq_cst) && sizeof(bridge_frame) + payload <= bridge_max_frame) {
+                    try {
+                        std::unique_lock lock(mutex_);
+                        space_.wait(lock, [this] { return staged_frames_ < max_pending_ || failed_; });
+                        if (!failed_) {
+                            std::size_t offset = staged_.size();
+                            staged_.resize(offset + sizeof(bridge_frame) + payload);
+                            bridge_frame frame{static_cast<std::uint32_t>(I), static_cast<std::uint32_t>(payload)};
+                            std::memcpy(staged_.data() + offset, &frame, sizeof(frame));
+                            wire_writer writer{staged_.data() + offset + sizeof(frame)};
+                            fields::Encode_args(writer, args...);
+                            if (staged_frames_++ == 0) {
+                                ready_.notify_one();
+                            }
+                            staged = true;
+                        }
+                    }
+                    catch (...) {
+                    }
+                }
+                if (!staged) {
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                }
+                Leave();
+            }
+
+            // Refuses new frames, sends everything staged and stops the writer. A receiver that does not take
+            // it all within the linger is given up on: the socket is shut down and what is left is dropped.
+            void Close() {
+                if (closed_.exchange(true, std::memory_order_seq_cst)) {
+                    return;
+                }
+                {
+                    std::unique_lock lock(mutex_);
+                    stopping_ = true;
+                    ready_.notify_one();
+                    auto idle = [this] { return done_ && inflight_.load(std::memory_order_seq_cst) == 0; };
+                    if (!idle_.wait_for(lock, linger_, idle)) {
+                        failed_ = true;
+                        ready_.notify_one();
+                        space_.notify_all();
+                        ::shutdown(socket_.native_handle(), SHUT_RDWR);
+                        idle_.wait(lock, idle);
+                    }
+                }
+                writer_.join();
+            }
+
+            std::uint64_t Sent() const noexcept { return sent_.load(std::memory_order_relaxed); }
+            std::uint64_t Packets() const noexcept { return packets_.load(std::memory_order_relaxed); }
+            std::uint64_t Dropped() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+        private:
+            // Ends a Stage call; the last one after Close lets the writer finish.
+            void Leave() noexcept {
+                if (inflight_.fetch_sub(1, std::memory_order_seq_cst) == 1 && closed_.load(std::memory_order_seq_cst)) {
+                    std::lock_guard lock(mutex_);
+                    ready_.notify_one();
+                    idle_.notify_all();
+                }
+            }
+
+            void Finish() {
+                done_ = true;
+                idle_.notify_all();
+            }
+
+            void Run() {
+                std::vector<std::byte> sending;
+                for (;;) {
+                    std::size_t frames;
+                    {
+                        std::unique_lock lock(mutex_);
+                        ready_.wait(lock, [this] {
+                            return staged_frames_ != 0 || failed_ || (stopping_ && inflight_.load(std::memory_order_seq_cst) == 0);
+                        });
+                        if (staged_frames_ == 0) {
+                            Finish();
+                            return;
+                        }
+                        std::swap(staged_, sending);
+                        frames = std::exchange(staged_frames_, 0);
+                    }
+                    space_.notify_all();
+
+                    if (!Send(sending)) {
+                        std::lock_guard lock(mutex_);
+                        failed_ = true;
+                        dropped_.fetch_add(frames + staged_frames_, std::memory_order_relaxed);
+                        staged_.clear();
+                        staged_frames_ = 0;
+                        space_.notify_all();
+                        Finish();
+                        return;
+                    }
+                    sending.clear();
+                }
+            }
+
+            bool Send(const std::vector<std::byte>& frames) {
+                int fd = socket_.native_handle();
+                for (std::size_t offset = 0; offset < frames.size();) {
+                    for (bridge_packet credit{}; bridge_receive(fd, credit, credits_ == 0 ? 0 : MSG_DONTWAIT);) {
+                        if (credit.kind_ != bridge_credit) {
+                            return false;
+                        }
+                        credits_ += credit.count_;
+                    }
+                    if (credits_ == 0) {
+                        return false; // the blocking read above failed: the receiver is gone
+                    }
+
+                    std::size_t end = offset, count = 0;
+                    while (end < frames.size() && count < credits_) {
+                        bridge_frame frame;
+                        std::memcpy(&frame, frames.data() + end, sizeof(frame));
+                        std::size_t size = sizeof(frame) + frame.size_;
+                        if (end - offset + size > bridge_max_frame) {
+                            break;
+                        }
+                        end += size;
+                        count++;
+                    }
+
+                    bridge_packet packet{bridge_data, static_cast<std::uint32_t>(count), 0};
+                    iovec  parts[2] = {{&packet, sizeof(packet)}, {const_cast<std::byte*>(frames.data() + offset), end - offset}};
+                    msghdr message{};
+                    message.msg_iov    = parts;
+                    message.msg_iovlen = 2;
+                    ssize_t result;
+                    do {
+                        result = ::sendmsg(fd, &message, MSG_NOSIGNAL);
+                    } while (result < 0 && errno == EINTR);
+                    if (result != static_cast<ssize_t>(sizeof(packet) + end - offset)) {
+                        return false;
+                    }
+                    credits_ -= count;
+                    sent_.fetch_add(count, std::memory_order_relaxed);
+                    packets_.fetch_add(1, std::memory_order_relaxed);
+                    offset = end;
+                }
+                return true;
+            }
+
+            seqpacket_socket           socket_;
+            std::size_t                max_pending_;
+            std::chrono::milliseconds  linger_;
+            std::uint64_t              credits_ = 0; // writer thread only, after construction
+            std::mutex                 mutex_;
+            std::condition_variable    ready_;
+            std::condition_variable    space_;
+            std::condition_variable    idle_;
+            std::vector<std::byte>     staged_;
+            std::size_t                staged_frames_ = 0;
+            bool                       stopping_      = false;
+            bool                       failed_        = false;
+            bool                       done_          = false; // the writer has returned
+            std::atomic_bool           closed_        = false;
+            std::atomic<std::uint32_t> inflight_      = 0;
+            std::atomic<std::uint64_t> sent_          = 0;
+            std::atomic<std::uint64_t> packets_       = 0;
+            std::atomic<std::uint64_t> dropped_       = 0;
+            std::thread                writer_;
+        };
+    }
+
+    // Forwards every emission of Signals... on an emitter to a bridge_receiver at the other end of a
+    // SOCK_SEQPACKET socket. Construction waits for the receiver's greeting, which carries its signal
+    // list and initial credit window. Emissions are codec-encoded on the emitting thread and sent by a
+    // writer thread, many per packet. The emitter must outlive the sender; the destructor disconnects
+    // and sends every staged frame, waiting up to linger for credit. Past it the socket is shut down and
+    // the frames left are dropped, so a receiver that stopped reading cannot hang the destructor.
+    template <emittable...Signals>
+    class bridge_sender {
+        using core = detail::bridge_sender_core<Signals...>;
+
+    public:
+        template <typename Emitter>
+            requires (std::derived_from<Emitter, detail::emitter_unit<Signals>> && ...)
+        bridge_sender(Emitter& emitter, seqpacket_socket socket, std::size_t max_pending = 4096,
+            std::chrono::milliseconds linger = std::chrono::seconds(5))
+            : core_(std::make_shared<core>(std::move(socket), max_pending, linger)) {
+            Connect(emitter, std::index_sequence_for<Signals...>{});
+        }
+
+        bridge_sender(const bridge_sender&) = delete;
+        bridge_sender& operator=(const bridge_sender&) = delete;
+
+        ~bridge_sender() {
+            for (auto& disconnect : disconnects_) {
+                disconnect();
+            }
+            core_->Close();
+        }
+
+        std::uint64_t sent() const noexcept { return core_->Sent(); }
+        std::uint64_t packets() const noexcept { return core_->Packets(); }
+
+        // Frames not sent: larger than a packet, emitted during close, staged when the peer went away or
+        // still staged when the linger ran out.
+        std::uint64_t dropped() const noexcept { return core_->Dropped(); }
+
+    private:
+        template <typename Emitter, std::size_t...Is>
+        void Connect(Emitter& emitter, std::index_sequence<Is...>) {
+            (Connect_one<Is, Signals>(emitter), ...);
+        }
+
+        template <std::size_t I, typename Signal, typename Emitter>
+        void Connect_one(Emitter& emitter) {
+            auto stage = stdexec::then([core = core_](const auto&...args) noexcept { core->template Stage<I>(args...); });
+            if constexpr (Signal::is_void_signal) {
+                auto con = daking::connect<Signal>(emitter, stdexec::just() | stage);
+                disconnects_.push_back([&emitter, con]() mutable { daking::disconnect<Signal>(emitter, con); });
+            }
+            else {
+                auto con = daking::connect<Signal>(emitter, std::move(stage));
+                disconnects_.push_back([&emitter, con]() mutable { daking::disconnect<Signal>(emitter, con); });
+            }
+        }
+
+        std::shared_ptr<core>              core_;
+        std::vector<std::function<void()>> disconnects_;
+    };
+
+    // Re-emits on a local emitter what a bridge_sender forwards. A reader thread takes up to 16 packets
+    // per recvmmsg, broadcasts every frame with emit(..., broadcast, emitter) and then returns that many
+    // credits, so at most window frames are ever in flight. The emitter must outlive the receiver.
+    template <emittable...Signals>
+    class bridge_receiver {
+    public:
+        template <typename Emitter>
+            requires (std::derived_from<Emitter, detail::emitter_unit<Signals>> && ...)
+        bridge_receiver(Emitter& emitter, seqpacket_socket socket, std::size_t window = 1024)
+            : socket_(std::move(socket)), emitter_(&emitter), dispatch_(&Dispatch<Emitter>) {
+            if (window == 0 || window > UINT32_MAX) {
+                throw std::invalid_argument("bridge_receiver window must be between 1 and 2^32 - 1 frames.");
+            }
+            if (!detail::bridge_send(socket_.native_handle(), {detail::bridge_hello, static_cast<std::uint32_t>(window), detail::codec_signature<Signals...>})) {
+                throw std::system_error(errno, std::generic_category(), "send");
+            }
+            reader_ = std::thread([this] { Run(); });
+        }
+
+        bridge_receiver(const bridge_receiver&) = delete;
+        bridge_receiver& operator=(const bridge_receiver&) = delete;
+
+        ~bridge_receiver() {
+            ::shutdown(socket_.native_handle(), SHUT_RDWR);
+            reader_.join();
+        }
+
+        std::uint64_t received() const noexcept { return received_.load(std::memory_order_acquire); }
+
+        // Frames that could not be decoded, and packets that were truncated or not data.
+        std::uint64_t malformed() const noexcept { return malformed_.load(std::memory_order_relaxed); }
+
+        // Whether the sender is still connected.
+        bool connected() const noexcept { return connected_.load(std::memory_order_acquire); }
+
+    private:
+        using dispatch = void(*)(std::size_t, std::span<const std::byte>, void*);
+
+        template <typename Emitter>
+        static void Dispatch(std::size_t id, std::span<const std::byte> payload, void* emitter) {
+            detail::id_dispatch<Emitter, detail::signal_list<Signals...>>::Dispatch(id, payload, static_cast<Emitter*>(emitter));
+        }
+
+        void Run() {
+            using namespace detail;
+            int  fd      = socket_.native_handle();
+            auto storage = std::make_unique<std::byte[]>(bridge_batch * bridge_max_packet);
+            iovec   parts[bridge_batch];
+            mmsghdr messages[bridge_batch];
+            for (;;) {
+                for (std::size_t i = 0; i < bridge_batch; i++) {
+                    parts[i]    = {storage.get() + i * bridge_max_packet, bridge_max_packet};
+                    messages[i] = {};
+                    messages[i].msg_hdr.msg_iov    = &parts[i];
+                    messages[i].msg_hdr.msg_iovlen = 1;
+                }
+                int received = ::recvmmsg(fd, messages, bridge_batch, MSG_WAITFORONE, nullptr);
+                if (received < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (received <= 0) {
+                    break;
+                }
+
+                // A zero-length message is the sender hanging up; nothing follows it.
+                std::uint64_t consumed = 0;
+                bool          closed   = false;
+                for (int i = 0; i < received && !(closed = messages[i].msg_len == 0); i++) {
+                    consumed += Deliver(static_cast<const std::byte*>(parts[i].iov_base), messages[i].msg_len, messages[i].msg_hdr.msg_flags);
+                }
+                if (closed) {
+                    break;
+                }
+                if (consumed != 0) {
+                    // A sender that already hung up takes no credit, but what it sent before is still queued here.
+                    bridge_send(fd, {bridge_credit, static_cast<std::uint32_t>(consumed), 0});
+                }
+            }
+            connected_.store(false, std::memory_order_release);
+        }
+
+        // Returns the frames the packet claimed, which go back to the sender as credit.
+        std::uint64_t Deliver(const std::byte* data, std::size_t size, int flags) {
+            using namespace detail;
+            bridge_packet packet;
+            if (size < sizeof(packet) || (flags & MSG_TRUNC)) {
+                malformed_.fetch_add(1, std::memory_order_relaxed);
+                return 0;
+            }
+            std::memcpy(&packet, data, sizeof(packet));
+            if (packet.kind_ != bridge_data) {
+                malformed_.fetch_add(1, std::memory_order_relaxed);
+                return 0;
+            }
+
+            std::size_t offset = sizeof(packet);
+            for (std::uint32_t i = 0; i < packet.count_; i++) {
+                bridge_frame frame;
+                if (offset + sizeof(frame) > size) {
+                    malformed_.fetch_add(packet.count_ - i, std::memory_order_relaxed);
+                    break;
+                }
+                std::memcpy(&frame, data + offset, sizeof(frame));
+                offset += sizeof(frame);
+                if (frame.signal_ >= sizeof...(Signals) || frame.size_ > size - offset) {
+                    malformed_.fetch_add(packet.count_ - i, std::memory_order_relaxed);
+                    break;
+                }
+                try {
+                    dispatch_(frame.signal_, std::span<const std::byte>(data + offset, frame.size_), emitter_);
+                    received_.fetch_add(1, std::memory_order_release);
+                }
+                catch (const std::runtime_error&) {
+                    malformed_.fetch_add(1, std::memory_order_relaxed);
+                }
+                offset += frame.size_;
+            }
+            return packet.count_;
+        }
+
+        seqpacket_socket           socket_;
+        void*                      emitter_;
+        dispatch                   dispatch_;
+        std::atomic<std::uint64_t> received_  = 0;
+        std::atomic<std::uint64_t> malformed_ = 0;
+        std::atomic_bool           connected_ = true;
+        std::thread                reader_;
+    };
+}
+
+#endif // __linux__
+
+#endif // !DAKING_SIGNAL_BRIDGE_HPP
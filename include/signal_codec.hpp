@@ -0,0 +1,543 @@
+/*
+MIT License
+
+Copyright (c) 2026 dakingffo
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#if defined(_MSC_VER) && _MSC_VER > 1000 || defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 3)
+#pragma once
+#endif
+
+#ifndef DAKING_SIGNAL_CODEC_HPP
+#define DAKING_SIGNAL_CODEC_HPP
+
+#include "signal.hpp"
+
+#include <array>
+#include <bit>
+#include <cstring>
+#include <initializer_list>
+#include <span>
+
+namespace daking {
+    namespace detail {
+        template <typename T>
+        struct wire;
+
+        // Folds values into an FNV-1a fingerprint. Each wire format describes itself with one, its tag,
+        // so that peers can tell formats apart that happen to share sizes.
+        inline constexpr std::uint64_t wire_tag(std::initializer_list<std::uint64_t> values) noexcept {
+            std::uint64_t hash = 14695981039346656037ull;
+            for (std::uint64_t v : values) {
+                hash = (hash ^ v) * 1099511628211ull;
+            }
+            return hash;
+        }
+
+        struct wire_writer {
+            DAKING_ALWAYS_INLINE void Bytes(const void* data, std::size_t size) noexcept {
+                if (size == 0) {
+                    return; // Empty containers may hand out a null data().
+                }
+                std::memcpy(out_, data, size);
+                out_ += size;
+            }
+
+            DAKING_ALWAYS_INLINE void Varint(std::uint64_t value) noexcept {
+                while (value >= 0x80) {
+                    *out_++ = static_cast<std::byte>(value | 0x80);
+                    value >>= 7;
+                }
+                *out_++ = static_cast<std::byte>(value);
+            }
+
+            std::byte* out_;
+        };
+
+        struct wire_reader {
+            DAKING_ALWAYS_INLINE const std::byte* Take(std::size_t size) {
+                if (static_cast<std::size_t>(end_ - in_) < size) {
+                    throw std::runtime_error("Can't decode signal: the payload is truncated.");
+                }
+                auto taken = in_;
+                in_ += size;
+                return taken;
+            }
+
+            DAKING_ALWAYS_INLINE std::uint64_t Varint() {
+                std::uint64_t value = 0;
+                for (unsigned shift = 0; shift < 64; shift += 7) {
+                    auto byte = static_cast<std::uint64_t>(*Take(1));
+                    value |= (byte & 0x7f) << shift;
+                    if (!(byte & 0x80)) {
+                        return value;
+                    }
+                }
+                throw std::runtime_error("Can't decode signal: malformed length prefix.");
+            }
+
+            // A count read off the wire can claim at most one element per remaining byte.
+            DAKING_ALWAYS_INLINE std::size_t Count() {
+                std::uint64_t count = Varint();
+                if (count > static_cast<std::uint64_t>(end_ - in_)) {
+                    throw std::runtime_error("Can't decode signal: the payload is truncated.");
+                }
+                return static_cast<std::size_t>(count);
+            }
+
+            const std::byte* in_;
+            const std::byte* end_;
+        };
+
+        inline constexpr std::size_t varint_size(std::uint64_t value) noexcept {
+            std::size_t size = 1;
+            while (value >= 0x80) {
+                value >>= 7;
+                size++;
+            }
+            return size;
+        }
+
+        template <typename T>
+        inline constexpr bool is_little_endian_arithmetic = (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+            && (std::endian::native == std::endian::little || sizeof(T) == 1);
+
+        // Arithmetic and enum values: fixed width, little-endian.
+        template <typename T>
+            requires (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+        struct wire<T> {
+            static constexpr bool          fixed = true;
+            static constexpr std::uint64_t tag   = wire_tag({
+                std::is_same_v<T, bool> ? 'b' : std::is_enum_v<T> ? 'e' : std::is_floating_point_v<T> ? 'f'
+                    : std::is_same_v<T, char> ? 'c' : std::is_signed_v<T> ? 's' : 'u', sizeof(T)});
+
+            static constexpr std::size_t Size(const T&) noexcept {
+                return sizeof(T);
+            }
+
+            static void Encode(wire_writer& out, const T& value) noexcept {
+                if constexpr (is_little_endian_arithmetic<T>) {
+                    out.Bytes(&value, sizeof(T));
+                }
+                else {
+                    auto raw = std::bit_cast<std::array<std::byte, sizeof(T)>>(value);
+                    for (std::size_t i = sizeof(T); i-- > 0;) {
+                        out.Bytes(&raw[i], 1);
+                    }
+                }
+            }
+
+            static T Decode(wire_reader& in) {
+                if constexpr (std::is_same_v<T, bool>) {
+                    return *in.Take(1) != std::byte{0}; // Only 0 and 1 are valid bool representations.
+                }
+                else {
+                    std::array<std::byte, sizeof(T)> raw;
+                    std::memcpy(raw.data(), in.Take(sizeof(T)), sizeof(T));
+                    if constexpr (!is_little_endian_arithmetic<T>) {
+                        std::reverse(raw.begin(), raw.end());
+                    }
+                    return std::bit_cast<T>(raw);
+                }
+            }
+        };
+
+        // Any other trivially copyable type travels as its object representation: one memcpy each way.
+        // Such types are only portable between hosts that share their layout and byte order.
+        template <typename T>
+            requires (std::is_trivially_copyable_v<T> && !std::is_arithmetic_v<T> && !std::is_enum_v<T>
+                && std::is_default_constructible_v<T>)
+        struct wire<T> {
+            static constexpr bool          fixed = true;
+            static constexpr std::uint64_t tag   = wire_tag({'r', sizeof(T), alignof(T)});
+
+            static constexpr std::size_t Size(const T&) noexcept {
+                return sizeof(T);
+            }
+
+            static void Encode(wire_writer& out, const T& value) noexcept {
+                out.Bytes(&value, sizeof(T));
+            }
+
+            static T Decode(wire_reader& in) {
+                T value;
+                std::memcpy(&value, in.Take(sizeof(T)), sizeof(T));
+                return value;
+            }
+        };
+
+        template <typename T>
+        concept wire_encodable = requires { wire<T>::fixed; };
+
+        // Elements whose wire form is their little-endian object representation go in one memcpy.
+        template <typename T>
+        inline constexpr bool wire_bulk = is_little_endian_arithmetic<T>
+            || (std::is_trivially_copyable_v<T> && !std::is_arithmetic_v<T> && !std::is_enum_v<T> && std::is_default_constructible_v<T>);
+
+        template <typename Char, typename Traits, typename Allocator>
+            requires wire_bulk<Char>
+        struct wire<std::basic_string<Char, Traits, Allocator>> {
+            using string = std::basic_string<Char, Traits, Allocator>;
+            static constexpr bool          fixed = false;
+            static constexpr std::uint64_t tag   = wire_tag({'S', wire<Char>::tag});
+
+            static std::size_t Size(const string& value) noexcept {
+                return varint_size(value.size()) + value.size() * sizeof(Char);
+            }
+
+            static void Encode(wire_writer& out, const string& value) noexcept {
+                out.Varint(value.size());
+                out.Bytes(value.data(), value.size() * sizeof(Char));
+            }
+
+            static string Decode(wire_reader& in) {
+                std::size_t size  = in.Count();
+                auto        bytes = in.Take(size * sizeof(Char));
+                string value(size, Char{});
+                std::memcpy(value.data(), bytes, size * sizeof(Char));
+                return value;
+            }
+        };
+
+        template <wire_encodable T, typename Allocator>
+        struct wire<std::vector<T, Allocator>> {
+            using vector = std::vector<T, Allocator>;
+            static constexpr bool          fixed = false;
+            static constexpr std::uint64_t tag   = wire_tag({'V', wire<T>::tag});
+
+            static_assert(!std::is_same_v<T, bool>,
+                "std::vector<bool> is packed, with no contiguous storage to encode; use std::vector<std::uint8_t>.");
+
+            static std::size_t Size(const vector& value) noexcept {
+                if constexpr (wire_bulk<T>) {
+                    return varint_size(value.size()) + value.size() * sizeof(T);
+                }
+                else {
+                    std::size_t size = varint_size(value.size());
+                    for (const auto& element : value) {
+                        size += wire<T>::Size(element);
+                    }
+                    return size;
+                }
+            }
+
+            static void Encode(wire_writer& out, const vector& value) noexcept {
+                out.Varint(value.size());
+                if constexpr (wire_bulk<T>) {
+                    out.Bytes(value.data(), value.size() * sizeof(T));
+                }
+                else {
+                    for (const auto& element : value) {
+                        wire<T>::Encode(out, element);
+                    }
+                }
+            }
+
+            static vector Decode(wire_reader& in) {
+                std::size_t size = in.Count();
+                vector value;
+                if constexpr (wire_bulk<T>) {
+                    auto bytes = in.Take(size * sizeof(T));
+                    value.resize(size);
+                    if (size != 0) {
+                        std::memcpy(value.data(), bytes, size * sizeof(T));
+                    }
+                }
+                else {
+                    value.reserve(size);
+                    for (std::size_t i = 0; i < size; i++) {
+                        value.push_back(wire<T>::Decode(in));
+                    }
+                }
+                return value;
+            }
+        };
+
+        template <wire_encodable T>
+        struct wire<std::optional<T>> {
+            static constexpr bool          fixed = false;
+            static constexpr std::uint64_t tag   = wire_tag({'O', wire<T>::tag});
+
+            static std::size_t Size(const std::optional<T>& value) noexcept {
+                return 1 + (value ? wire<T>::Size(*value) : 0);
+            }
+
+            static void Encode(wire_writer& out, const std::optional<T>& value) noexcept {
+                wire<bool>::Encode(out, value.has_value());
+                if (value) {
+                    wire<T>::Encode(out, *value);
+                }
+            }
+
+            static std::optional<T> Decode(wire_reader& in) {
+                if (!wire<bool>::Decode(in)) {
+                    return std::nullopt;
+                }
+                return wire<T>::Decode(in);
+            }
+        };
+
+        // The fields of a tuple in order, without framing; shared by signal payloads and nested tuples.
+        template <wire_encodable...Ts>
+        struct wire_fields {
+            static constexpr std::uint64_t tag = wire_tag({sizeof...(Ts), wire<Ts>::tag...});
+
+            static std::size_t Size_of_args(const Ts&...fields) noexcept {
+                return (std::size_t(0) + ... + wire<Ts>::Size(fields));
+            }
+
+            static void Encode_args(wire_writer& out, const Ts&...fields) noexcept {
+                (wire<Ts>::Encode(out, fields), ...);
+            }
+
+            static std::size_t Size(const std::tuple<Ts...>& value) noexcept {
+                return std::apply([](const Ts&...fields) { return Size_of_args(fields...); }, value);
+            }
+
+            static void Encode(wire_writer& out, const std::tuple<Ts...>& value) noexcept {
+                std::apply([&](const Ts&...fields) { Encode_args(out, fields...); }, value);
+            }
+
+            static std::tuple<Ts...> Decode(wire_reader& in) {
+                return std::tuple<Ts...>{wire<Ts>::Decode(in)...}; // Braced initialization decodes left to right.
+            }
+        };
+
+        // Nested tuples and pairs carry their byte length, so a reader can skip them whole.
+        template <wire_encodable...Ts>
+        struct wire<std::tuple<Ts...>> {
+            static constexpr bool          fixed = false;
+            static constexpr std::uint64_t tag   = wire_tag({'T', wire_fields<Ts...>::tag});
+
+            static std::size_t Size(const std::tuple<Ts...>& value) noexcept {
+                std::size_t size = wire_fields<Ts...>::Size(value);
+                return varint_size(size) + size;
+            }
+
+            static void Encode(wire_writer& out, const std::tuple<Ts...>& value) noexcept {
+                out.Varint(wire_fields<Ts...>::Size(value));
+                wire_fields<Ts...>::Encode(out, value);
+            }
+
+            static std::tuple<Ts...> Decode(wire_reader& in) {
+                std::size_t size  = in.Count();
+                wire_reader inner{in.Take(size), nullptr};
+                inner.end_ = inner.in_ + size;
+                auto value = wire_fields<Ts...>::Decode(inner);
+                if (inner.in_ != inner.end_) {
+                    throw std::runtime_error("Can't decode signal: a nested tuple does not match its length.");
+                }
+                return value;
+            }
+        };
+
+        template <wire_encodable First, wire_encodable Second>
+        struct wire<std::pair<First, Second>> {
+            static constexpr bool          fixed = false;
+            static constexpr std::uint64_t tag   = wire_tag({'P', wire_fields<First, Second>::tag});
+
+            static std::size_t Fields(const std::pair<First, Second>& value) noexcept {
+                return wire<First>::Size(value.first) + wire<Second>::Size(value.second);
+            }
+
+            static std::size_t Size(const std::pair<First, Second>& value) noexcept {
+                std::size_t size = Fields(value);
+                return varint_size(size) + size;
+            }
+
+            static void Encode(wire_writer& out, const std::pair<First, Second>& value) noexcept {
+                out.Varint(Fields(value));
+                wire<First>::Encode(out, value.first);
+                wire<Second>::Encode(out, value.second);
+            }
+
+            static std::pair<First, Second> Decode(wire_reader& in) {
+                auto [first, second] = wire<std::tuple<First, Second>>::Decode(in);
+                return {std::move(first), std::move(second)};
+            }
+        };
+
+        template <typename Signal>
+        struct signal_fields;
+
+        template <signal_arg...Args>
+        struct signal_fields<signal<Args...>> {
+            using type = wire_fields<Args...>;
+        };
+
+        template <>
+        struct signal_fields<signal<void>> {
+            using type = wire_fields<>;
+        };
+
+        // Fingerprint of a signal list for peers exchanging encoded records: the wire tag of every argument of
+        // every signal, in order. Type names are not portable across compilers; wire formats are.
+        template <emittable...Signals>
+        inline constexpr std::uint64_t codec_signature = wire_tag({sizeof...(Signals), signal_fields<signal_degradation_t<Signals>>::type::tag...});
+
+        // Signals that inherit the forwarding constructor take the arguments directly; plain aggregates
+        // deriving from a signal template are initialized through their base.
+        template <typename Signal, typename...Args>
+        Signal make_signal(std::tuple<Args...>&& args) {
+            return std::apply([]<typename...T>(T&&...value) -> Signal {
+                if constexpr (std::is_constructible_v<Signal, T&&...>) {
+                    return Signal(std::forward<T>(value)...);
+                }
+                else {
+                    return Signal{typename Signal::base(std::forward<T>(value)...)};
+                }
+            }, std::move(args));
+        }
+    }
+
+    // Compile-time binary codec for a signal's payload: its arguments in order, little-endian, with no
+    // header. Arithmetic, enum and other trivially copyable arguments are copied as-is, strings and vectors
+    // are prefixed with a varint count and nested tuples with a varint byte length. Encoding sizes and
+    // writes the payload in two passes with no allocation; decoding checks every read against the input.
+    template <emittable Signal>
+    struct codec {
+        // Exact number of bytes encode() writes for this emission.
+        static std::size_t size(const Signal& signal) noexcept {
+            if constexpr (Signal::is_void_signal) {
+                return 0;
+            }
+            else {
+                return fields::Size(signal.args_);
+            }
+        }
+
+        // Writes the payload to out, which must hold size(signal) bytes; returns the bytes written.
+        static std::size_t encode(const Signal& signal, std::byte* out) noexcept {
+            if constexpr (Signal::is_void_signal) {
+                return 0;
+            }
+            else {
+                detail::wire_writer writer{out};
+                fields::Encode(writer, signal.args_);
+                return static_cast<std::size_t>(writer.out_ - out);
+            }
+        }
+
+        // Appends the payload to out.
+        static void encode(const Signal& signal, std::vector<std::byte>& out) {
+            std::size_t offset = out.size();
+            out.resize(offset + size(signal));
+            encode(signal, out.data() + offset);
+        }
+
+        // Rebuilds the emission; throws std::runtime_error if in is not exactly one payload.
+        static Signal decode(std::span<const std::byte> in) {
+            if constexpr (Signal::is_void_signal) {
+                if (!in.empty()) {
+                    throw std::runtime_error("Can't decode signal: trailing bytes after the payload.");
+                }
+                return Signal{};
+            }
+            else {
+                detail::wire_reader reader{in.data(), in.data() + in.size()};
+                auto args = fields::Decode(reader);
+                if (reader.in_ != reader.end_) {
+                    throw std::runtime_error("Can't decode signal: trailing bytes after the payload.");
+                }
+                return detail::make_signal<Signal>(std::move(args));
+            }
+        }
+
+    private:
+        using fields = typename detail::signal_fields<detail::signal_degradation_t<Signal>>::type;
+    };
+
+    namespace detail {
+        template <typename...Signals>
+        struct signal_list {};
+
+        template <typename Threading, typename...Signals>
+        signal_list<Signals...> signals_of(const emitter_impl<Threading, Signals...>*);
+
+        template <typename Emitter>
+        using emitter_signals_t = decltype(signals_of(std::declval<const Emitter*>()));
+
+        template <typename Signal, typename...Signals>
+        inline constexpr std::size_t signal_index = []() consteval {
+            constexpr bool matches[] = {std::same_as<Signal, Signals>...};
+            for (std::size_t i = 0; i < sizeof...(Signals); i++) {
+                if (matches[i]) {
+                    return i;
+                }
+            }
+            return sizeof...(Signals);
+        }();
+
+        // One entry per signal of List, in order: decode the payload into that signal and broadcast it.
+        template <typename Emitter, typename List = emitter_signals_t<Emitter>>
+        struct id_dispatch;
+
+        template <typename Emitter, typename...Signals>
+        struct id_dispatch<Emitter, signal_list<Signals...>> {
+            using entry = void(*)(std::span<const std::byte>, Emitter*);
+
+            template <typename Signal>
+            static void Entry(std::span<const std::byte> bytes, Emitter* emitter) {
+                emit_t{}(codec<Signal>::decode(bytes), broadcast_t{}, emitter);
+            }
+
+            static constexpr entry table[] = {&Entry<Signals>...};
+
+            DAKING_ALWAYS_INLINE static void Dispatch(std::size_t id, std::span<const std::byte> bytes, Emitter* emitter) {
+                if (id >= sizeof...(Signals)) [[unlikely]] {
+                    throw std::runtime_error("Can't emit by id: the emitter has no signal with this id.");
+                }
+                table[id](bytes, emitter);
+            }
+        };
+
+        struct emit_by_id_t {
+            template <emitter Emitter>
+            DAKING_ALWAYS_INLINE void operator()(std::size_t id, std::span<const std::byte> bytes, broadcast_t, Emitter* emitter) const {
+                id_dispatch<Emitter>::Dispatch(id, bytes, emitter);
+            }
+
+            template <emitter Emitter>
+            DAKING_ALWAYS_INLINE void operator()(std::size_t id, std::span<const std::byte> bytes, broadcast_t, Emitter& emitter) const {
+                this->operator()(id, bytes, broadcast_t{}, &emitter);
+            }
+        };
+
+        template <emittable Signal, typename List>
+        struct signal_id_in;
+
+        template <emittable Signal, typename...Signals>
+        struct signal_id_in<Signal, signal_list<Signals...>> {
+            static_assert(signal_index<Signal, Signals...> < sizeof...(Signals), "The emitter does not emit this signal.");
+            static constexpr std::size_t value = signal_index<Signal, Signals...>;
+        };
+    }
+
+    // Position of Signal in the enable_signal<...> list of Emitter: the id emit_by_id() dispatches on.
+    template <emittable Signal, emitter Emitter>
+    inline constexpr std::size_t signal_id = detail::signal_id_in<Signal, detail::emitter_signals_t<Emitter>>::value;
+
+    // Decodes a codec payload into the emitter's id-th signal and broadcasts it, through a table of one
+    // entry per signal built at compile time: a bounds check and one indirect call, whatever the id.
+    // Throws std::runtime_error for an unknown id or a malformed payload.
+    inline constexpr detail::emit_by_id_t emit_by_id;
+}
+
+#endif // !DAKING_SIGNAL_CODEC_HPP
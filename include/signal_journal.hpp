@@ -0,0 +1,512 @@
+/*
+MIT License
+
+Copyright (c) 2026 dakingffo
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#if defined(_MSC_VER) && _MSC_VER > 1000 || defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 3)
+#pragma once
+#endif
+
+#ifndef DAKING_SIGNAL_JOURNAL_HPP
+#define DAKING_SIGNAL_JOURNAL_HPP
+#include "signal_codec.hpp"
+
+#if defined(__linux__)
+
+#include <deque>
+#include <cerrno>
+#include <system_error>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace daking {
+    namespace detail {
+        inline constexpr std::uint64_t journal_magic   = 0x4c4e524a474b4144ull; // "DAKGJRNL"
+        inline constexpr std::uint32_t journal_version = 1;
+
+        struct alignas(cache_line) journal_file_header {
+            std::uint64_t magic_;
+            std::uint32_t version_;
+            std::uint32_t signals_;
+            std::uint64_t signature_;
+            std::uint64_t index_;
+        };
+
+        // Records are 8-byte aligned and committed by their size word, which stays zero while the record is written.
+        struct journal_record {
+            std::atomic<std::uint32_t> size_;     // whole record, header included
+            std::uint32_t              signal_;   // position in the journal's signal list
+            std::uint64_t              sequence_;
+            std::int64_t               time_;     // steady_clock nanoseconds
+            std::uint32_t              payload_;  // codec bytes; the rest up to size_ is padding
+        };
+
+        inline constexpr std::size_t journal_align = alignof(journal_record);
+
+        inline std::string journal_segment_name(const std::string& path, std::uint64_t index) {
+            std::string digits = std::to_string(index);
+            return path + "." + std::string(digits.size() < 6 ? 6 - digits.size() : 0, '0') + digits;
+        }
+
+        // One mmap'd file of the log. Writers reserve space by bumping tail_; the one whose reservation
+        // crosses the end records how much of the file holds records and rotates to the next segment.
+        struct journal_segment {
+            std::byte*                 data_     = nullptr;
+            std::size_t                capacity_ = 0;
+            int                        fd_       = -1;
+            std::atomic<std::uint64_t> tail_     = sizeof(journal_file_header);
+            std::atomic<std::uint64_t> used_     = 0;
+            std::atomic<std::uint32_t> writers_  = 0;
+            std::string                name_;
+            bool                       sealed_   = false;
+        };
+
+        // State shared by the journal and the slots it connects; slots hold it until their last emission is done.
+        template <emittable...Signals>
+        class journal_core {
+        public:
+            journal_core(std::string path, std::size_t segment_size)
+                : path_(std::move(path)), segment_size_(segment_size) {
+                if (segment_size_ < 2 * sizeof(journal_file_header) || segment_size_ % journal_align != 0) {
+                    throw std::invalid_argument("journal segment size must be a multiple of 8 and hold at least one record.");
+                }
+                active_.store(Open(next_index_++, false), std::memory_order_release);
+                flusher_ = std::thread([this] { Run(); });
+            }
+
+            ~journal_core() {
+                Close();
+            }
+
+            template <std::size_t I, typename...Args>
+            void Record(const Args&...args) noexcept {
+                using fields = typename signal_fields<signal_degradation_t<std::tuple_element_t<I, std::tuple<Signals...>>>>::type;
+
+                inflight_.fetch_add(1, std::memory_order_seq_cst);
+                if (closed_.load(std::memory_order_seq_cst)) {
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                    inflight_.fetch_sub(1, std::memory_order_release);
+                    return;
+                }
+                std::size_t payload = fields::Size_of_args(args...);
+                std::size_t bytes   = (sizeof(journal_record) + payload + journal_align - 1) / journal_align * journal_align;
+                if (bytes > segment_size_ - sizeof(journal_file_header) || bytes > UINT32_MAX) {
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                    inflight_.fetch_sub(1, std::memory_order_release);
+                    return;
+                }
+
+                std::uint64_t sequence = sequence_.fetch_add(1, std::memory_order_relaxed);
+                std::int64_t  time     = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count();
+                bool appended = Append(bytes, [&](std::byte* at) noexcept {
+                    auto record       = ::new (at) journal_record;
+                    record->signal_   = static_cast<std::uint32_t>(I);
+                    record->sequence_ = sequence;
+                    record->time_     = time;
+                    record->payload_  = static_cast<std::uint32_t>(payload);
+                    wire_writer writer{at + sizeof(journal_record)};
+                    fields::Encode_args(writer, args...);
+                    record->size_.store(static_cast<std::uint32_t>(bytes), std::memory_order_release);
+                });
+                (appended ? recorded_ : dropped_).fetch_add(1, std::memory_order_relaxed);
+                inflight_.fetch_sub(1, std::memory_order_release);
+            }
+
+            // Refuses new records, waits for the ones being written and seals every segment.
+            void Close() {
+                if (closed_.exchange(true, std::memory_order_seq_cst)) {
+                    return;
+                }
+                for (std::size_t round = 0; inflight_.load(std::memory_order_seq_cst) != 0; round++) {
+                    spin_pause(round);
+                }
+                Wake();
+                flusher_.join();
+
+                std::lock_guard lock(files_);
+                auto active = active_.load(std::memory_order_acquire);
+                if (std::uint64_t tail = active->tail_.load(std::memory_order_relaxed); tail <= active->capacity_) {
+                    active->used_.store(tail, std::memory_order_relaxed); // otherwise the writer that overran it set used_
+                }
+                for (auto& segment : segments_) {
+                    if (!segment.sealed_) {
+                        Seal(segment);
+                    }
+                }
+                if (auto spare = spare_.exchange(nullptr)) {
+                    ::unlink(spare->name_.c_str()); // never written: keep the numbering contiguous
+                }
+            }
+
+            std::uint64_t Recorded() const noexcept { return recorded_.load(std::memory_order_relaxed); }
+            std::uint64_t Dropped() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+            std::uint64_t Stalls() const noexcept { return stalls_.load(std::memory_order_relaxed); }
+
+        private:
+            // False once the log could not rotate into a new file; nothing is written after that.
+            template <typename Write>
+            bool Append(std::size_t bytes, Write&& write) noexcept {
+                for (;;) {
+                    auto segment = active_.load(std::memory_order_acquire);
+                    if (failed_.load(std::memory_order_relaxed)) [[unlikely]] {
+                        return false;
+                    }
+                    segment->writers_.fetch_add(1, std::memory_order_seq_cst);
+                    if (active_.load(std::memory_order_seq_cst) != segment) {
+                        segment->writers_.fetch_sub(1, std::memory_order_release);
+                        continue;
+                    }
+
+                    std::uint64_t offset = segment->tail_.fetch_add(bytes, std::memory_order_relaxed);
+                    if (offset + bytes <= segment->capacity_) [[likely]] {
+                        write(segment->data_ + offset);
+                        segment->writers_.fetch_sub(1, std::memory_order_release);
+                        return true;
+                    }
+                    if (offset <= segment->capacity_) {
+                        // First reservation past the end: exactly one writer gets here per segment.
+                        segment->used_.store(offset, std::memory_order_relaxed);
+                        Rotate();
+                    }
+                    segment->writers_.fetch_sub(1, std::memory_order_release);
+                    for (std::size_t round = 0; active_.load(std::memory_order_acquire) == segment
+                        && !failed_.load(std::memory_order_acquire); round++) {
+                        spin_pause(round);
+                    }
+                }
+            }
+
+            // The flusher keeps a spare segment mapped and populated, so rotating is a pointer swap. Only if
+            // a whole segment filled before the spare was ready does the writer open the next file itself.
+            // The spare becomes active before it stops being the spare, so the flusher never sees it as retired.
+            // Any failure there, of the file system or of memory, stops the log rather than the process.
+            void Rotate() noexcept {
+                auto next = spare_.load(std::memory_order_acquire);
+                std::unique_lock lock(files_, std::defer_lock);
+                if (!next) {
+                    try {
+                        lock.lock();
+                        next = spare_.load(std::memory_order_acquire);
+                        if (!next) {
+                            stalls_.fetch_add(1, std::memory_order_relaxed);
+                            next = Open(next_index_++, false);
+                        }
+                    }
+                    catch (...) {
+                        failed_.store(true, std::memory_order_release);
+                        return;
+                    }
+                }
+                active_.store(next, std::memory_order_seq_cst);
+                spare_.store(nullptr, std::memory_order_seq_cst);
+                Wake();
+            }
+
+            void Wake() noexcept {
+                work_.fetch_add(1, std::memory_order_release);
+                work_.notify_one();
+            }
+
+            void Run() {
+                for (;;) {
+                    // Loaded before closed_, so a Wake() that follows Close() always ends the wait below.
+                    std::uint32_t seen = work_.load(std::memory_order_acquire);
+                    if (closed_.load(std::memory_order_acquire)) {
+                        return;
+                    }
+                    bool pending = false;
+                    {
+                        std::lock_guard lock(files_);
+                        if (!spare_.load(std::memory_order_acquire)) {
+                            try {
+                                spare_.store(Open(next_index_++, true), std::memory_order_release);
+                            }
+                            catch (...) {
+                                // Writers fall back to opening the segment themselves and report it there.
+                            }
+                        }
+                        auto spare  = spare_.load(std::memory_order_seq_cst);
+                        auto active = active_.load(std::memory_order_seq_cst);
+                        for (auto& segment : segments_) {
+                            if (segment.sealed_ || &segment == spare || &segment == active) {
+                                continue;
+                            }
+                            if (segment.writers_.load(std::memory_order_seq_cst) == 0) {
+                                Seal(segment);
+                            }
+                            else {
+                                pending = true;
+                            }
+                        }
+                    }
+                    if (pending) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    work_.wait(seen, std::memory_order_acquire);
+                }
+            }
+
+            // Allocates before it creates the file, so a failure leaves neither a file nor a mapping behind.
+            journal_segment* Open(std::uint64_t index, bool populate) {
+                std::string name    = journal_segment_name(path_, index);
+                auto&       segment = segments_.emplace_back();
+                int fd = ::open(name.c_str(), O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0644);
+                if (fd < 0) {
+                    int error = errno;
+                    segments_.pop_back();
+                    throw std::system_error(error, std::generic_category(), "open(" + name + ")");
+                }
+                if (::ftruncate(fd, static_cast<off_t>(segment_size_)) != 0) {
+                    int error = errno;
+                    ::close(fd);
+                    ::unlink(name.c_str());
+                    segments_.pop_back();
+                    throw std::system_error(error, std::generic_category(), "ftruncate(" + name + ")");
+                }
+                void* data = ::mmap(nullptr, segment_size_, PROT_READ | PROT_WRITE, MAP_SHARED | (populate ? MAP_POPULATE : 0), fd, 0);
+                if (data == MAP_FAILED) {
+                    int error = errno;
+                    ::close(fd);
+                    ::unlink(name.c_str());
+                    segments_.pop_back();
+                    throw std::system_error(error, std::generic_category(), "mmap(" + name + ")");
+                }
+
+                auto header        = ::new (data) journal_file_header;
+                header->magic_     = journal_magic;
+                header->version_   = journal_version;
+                header->signals_   = sizeof...(Signals);
+                header->signature_ = codec_signature<Signals...>;
+                header->index_     = index;
+
+                segment.data_     = static_cast<std::byte*>(data);
+                segment.capacity_ = segment_size_;
+                segment.fd_       = fd;
+                segment.name_     = std::move(name);
+                return &segment;
+            }
+
+            // Unmaps a segment no writer can reach any more and trims the file to the records it holds.
+            static void Seal(journal_segment& segment) noexcept {
+                ::munmap(segment.data_, segment.capacity_);
+                [[maybe_unused]] int result = ::ftruncate(segment.fd_, static_cast<off_t>(segment.used_.load(std::memory_order_relaxed)));
+                ::close(segment.fd_);
+                segment.data_   = nullptr;
+                segment.sealed_ = true;
+            }
+
+            std::string                     path_;
+            std::size_t                     segment_size_;
+            std::mutex                      files_;
+            std::deque<journal_segment>     segments_;    // stable addresses; guarded by files_
+            std::uint64_t                   next_index_ = 0;
+            std::atomic<journal_segment*>   active_     = nullptr;
+            std::atomic<journal_segment*>   spare_      = nullptr;
+            std::atomic<std::uint32_t>      work_       = 0;
+            std::atomic_bool                closed_     = false;
+            std::atomic_bool                failed_     = false;
+            std::atomic<std::uint32_t>      inflight_   = 0;
+            alignas(cache_line) std::atomic<std::uint64_t> sequence_ = 0;
+            alignas(cache_line) std::atomic<std::uint64_t> recorded_ = 0;
+            std::atomic<std::uint64_t>      dropped_    = 0;
+            std::atomic<std::uint64_t>      stalls_     = 0;
+            std::thread                     flusher_;
+        };
+
+        // A read-only view of one sealed segment file.
+        class journal_file {
+        public:
+            explicit journal_file(const std::string& name) {
+                int fd = ::open(name.c_str(), O_RDONLY | O_CLOEXEC);
+                if (fd < 0) {
+                    throw std::system_error(errno, std::generic_category(), "open(" + name + ")");
+                }
+                struct stat info{};
+                if (::fstat(fd, &info) != 0) {
+                    int error = errno;
+                    ::close(fd);
+                    throw std::system_error(error, std::generic_category(), "fstat(" + name + ")");
+                }
+                size_ = static_cast<std::size_t>(info.st_size);
+                if (size_ > 0) {
+                    void* data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+                    if (data == MAP_FAILED) {
+                        int error = errno;
+                        ::close(fd);
+                        throw std::system_error(error, std::generic_category(), "mmap(" + name + ")");
+                    }
+                    data_ = static_cast<const std::byte*>(data);
+                    ::madvise(data, size_, MADV_SEQUENTIAL);
+                }
+                ::close(fd);
+            }
+
+            journal_file(const journal_file&) = delete;
+
+            ~journal_file() {
+                if (data_) {
+                    ::munmap(const_cast<std::byte*>(data_), size_);
+                }
+            }
+
+            const std::byte* data() const noexcept { return data_; }
+            std::size_t      size() const noexcept { return size_; }
+
+        private:
+            const std::byte* data_ = nullptr;
+            std::size_t      size_ = 0;
+        };
+    }
+
+    enum class journal_pacing {
+        as_fast_as_possible,
+        original,
+    };
+
+    // Records every emission of Signals... on an emitter into a segment-rotated log at path.000000,
+    // path.000001, ... Each record carries the signal's position in Signals..., a sequence number and a
+    // steady_clock timestamp, followed by the codec payload. Appending never takes a lock: writers reserve
+    // space in the mapped segment with one atomic add, and a flusher thread keeps the next segment mapped
+    // and seals full ones. Concurrent emissions land in reservation order, which may differ from sequence order.
+    // The emitter must outlive the journal. The destructor disconnects and seals the log once records already
+    // being appended are written; slot work still queued on a scheduler then is counted in dropped().
+    template <emittable...Signals>
+    class journal {
+        using core = detail::journal_core<Signals...>;
+
+    public:
+        template <typename Emitter>
+            requires (std::derived_from<Emitter, detail::emitter_unit<Signals>> && ...)
+        journal(Emitter& emitter, std::string path, std::size_t segment_size = 16 << 20)
+            : core_(std::make_shared<core>(std::move(path), segment_size)) {
+            Connect(emitter, std::index_sequence_for<Signals...>{});
+        }
+
+        journal(const journal&) = delete;
+        journal& operator=(const journal&) = delete;
+
+        ~journal() {
+            for (auto& disconnect : disconnects_) {
+                disconnect();
+            }
+            core_->Close();
+        }
+
+        std::uint64_t recorded() const noexcept { return core_->Recorded(); }
+        // Emissions not in the log: too large for a segment, past close, or after the log failed to rotate.
+        std::uint64_t dropped() const noexcept { return core_->Dropped(); }
+
+        // Rotations that found no spare segment ready and had to open the next file on the emitting thread.
+        std::uint64_t stalls() const noexcept { return core_->Stalls(); }
+
+    private:
+        template <typename Emitter, std::size_t...Is>
+        void Connect(Emitter& emitter, std::index_sequence<Is...>) {
+            (Connect_one<Is, Signals>(emitter), ...);
+        }
+
+        template <std::size_t I, typename Signal, typename Emitter>
+        void Connect_one(Emitter& emitter) {
+            auto append = stdexec::then([core = core_](const auto&...args) noexcept { core->template Record<I>(args...); });
+            if constexpr (Signal::is_void_signal) {
+                auto con = daking::connect<Signal>(emitter, stdexec::just() | append);
+                disconnects_.push_back([&emitter, con]() mutable { daking::disconnect<Signal>(emitter, con); });
+            }
+            else {
+                auto con = daking::connect<Signal>(emitter, std::move(append));
+                disconnects_.push_back([&emitter, con]() mutable { daking::disconnect<Signal>(emitter, con); });
+            }
+        }
+
+        std::shared_ptr<core>              core_;
+        std::vector<std::function<void()>> disconnects_;
+    };
+
+    // Feeds a journal back through emit(..., broadcast, emitter), in log order, either as fast as possible
+    // or at the pacing the records were taken with. Reading stops at the first missing segment or at an
+    // incomplete record, which only the tail of a log whose writer died can hold.
+    template <emittable...Signals>
+    class journal_replayer {
+    public:
+        explicit journal_replayer(std::string path) : path_(std::move(path)) {}
+
+        template <typename Emitter>
+            requires (std::derived_from<Emitter, detail::emitter_unit<Signals>> && ...)
+        std::uint64_t replay(Emitter& emitter, journal_pacing pacing = journal_pacing::as_fast_as_possible) const {
+            using dispatch = detail::id_dispatch<Emitter, detail::signal_list<Signals...>>;
+
+            std::uint64_t replayed = 0;
+            std::int64_t  first    = 0;
+            auto          start    = std::chrono::steady_clock::now();
+            for (std::uint64_t index = 0;; index++) {
+                std::string name = detail::journal_segment_name(path_, index);
+                if (::access(name.c_str(), F_OK) != 0) {
+                    if (index == 0) {
+                        throw std::runtime_error("Can't replay journal: " + name + " does not exist.");
+                    }
+                    return replayed;
+                }
+                detail::journal_file file(name);
+                Check(file, index);
+
+                for (std::size_t offset = sizeof(detail::journal_file_header);
+                    offset + sizeof(detail::journal_record) <= file.size();) {
+                    auto record = reinterpret_cast<const detail::journal_record*>(file.data() + offset);
+                    std::uint32_t size = record->size_.load(std::memory_order_acquire);
+                    if (size < sizeof(detail::journal_record) || offset + size > file.size()
+                        || record->payload_ > size - sizeof(detail::journal_record) || record->signal_ >= sizeof...(Signals)) {
+                        return replayed;
+                    }
+                    if (pacing == journal_pacing::original) {
+                        if (replayed == 0) {
+                            first = record->time_;
+                        }
+                        std::this_thread::sleep_until(start + std::chrono::nanoseconds(record->time_ - first));
+                    }
+                    auto payload = file.data() + offset + sizeof(detail::journal_record);
+                    dispatch::table[record->signal_](std::span<const std::byte>(payload, record->payload_), &emitter);
+                    replayed++;
+                    offset += size;
+                }
+            }
+        }
+
+    private:
+        static void Check(const detail::journal_file& file, std::uint64_t index) {
+            auto header = reinterpret_cast<const detail::journal_file_header*>(file.data());
+            if (file.size() < sizeof(detail::journal_file_header) || header->magic_ != detail::journal_magic
+                || header->version_ != detail::journal_version || header->signals_ != sizeof...(Signals)
+                || header->signature_ != detail::codec_signature<Signals...> || header->index_ != index) {
+                throw std::runtime_error("Can't replay journal: a segment was not recorded for these signals.");
+            }
+        }
+
+        std::string path_;
+    };
+}
+
+#endif // __linux__
+
+#endif // !DAKING_SIGNAL_JOURNAL_HPP
@@ -0,0 +1,603 @@
+/*
+MIT License
+
+Copyright (c) 2026 dakingffo
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#if defined(_MSC_VER) && _MSC_VER > 1000 || defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 3)
+#pragma once
+#endif
+
+#ifndef DAKING_SIGNAL_SHM_HPP
+#define DAKING_SIGNAL_SHM_HPP
+
+#include "signal.hpp"
+
+#if defined(__linux__)
+
+#include <array>
+#include <climits>
+#include <csignal>
+#include <cstring>
+#include <new>
+#include <system_error>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace daking {
+    namespace detail {
+        struct unit_access {
+            template <emittable Signal, typename...Args>
+            DAKING_ALWAYS_INLINE static void Broadcast(emitter_unit<Signal>* unit, exec::async_scope* scope, const Args&...args) {
+                unit->Broadcast(scope, args...);
+            }
+        };
+
+        template <typename Signal>
+        struct shm_payload;
+
+        // Payload of a non-void signal: every argument at a fixed, naturally aligned offset.
+        template <signal_arg...Args>
+        struct shm_payload<signal<Args...>> {
+            static constexpr bool transportable = sizeof...(Args) > 0 && (std::is_trivially_copyable_v<Args> && ...)
+                && ((alignof(Args) <= cache_line) && ...);
+
+            static constexpr std::array<std::size_t, sizeof...(Args)> offsets = []() consteval {
+                std::array<std::size_t, sizeof...(Args)> result{};
+                std::size_t sizes[] = {sizeof(Args)...}, aligns[] = {alignof(Args)...}, offset = 0;
+                for (std::size_t i = 0; i < sizeof...(Args); i++) {
+                    offset    = (offset + aligns[i] - 1) / aligns[i] * aligns[i];
+                    result[i] = offset;
+                    offset   += sizes[i];
+                }
+                return result;
+            }();
+
+            static constexpr std::size_t size = offsets.back() + sizeof(std::tuple_element_t<sizeof...(Args) - 1, std::tuple<Args...>>);
+
+            // Both processes must agree on the layout; names are not portable across compilers, sizes are.
+            static constexpr std::uint64_t signature = []() consteval {
+                std::uint64_t hash = 14695981039346656037ull;
+                for (std::size_t v : {sizeof...(Args), sizeof(Args)..., alignof(Args)...}) {
+                    hash = (hash ^ v) * 1099511628211ull;
+                }
+                return hash;
+            }();
+
+            static void Store(std::byte* out, const Args&...args) noexcept {
+                [&]<std::size_t...Is>(std::index_sequence<Is...>) {
+                    (std::memcpy(out + offsets[Is], &args, sizeof(Args)), ...);
+                }(std::index_sequence_for<Args...>{});
+            }
+
+            // Hands the arguments to f where they lie in the cell; the cell is cache-line aligned,
+            // so every offset is suitably aligned for its type.
+            template <typename F>
+            static void Visit(const std::byte* in, F&& f) {
+                [&]<std::size_t...Is>(std::index_sequence<Is...>) {
+                    f(*std::launder(reinterpret_cast<const Args*>(in + offsets[Is]))...);
+                }(std::index_sequence_for<Args...>{});
+            }
+        };
+
+        template <typename Signal>
+        concept shm_transportable = emittable<Signal> && !Signal::is_void_signal
+            && shm_payload<signal_degradation_t<Signal>>::transportable;
+
+        static_assert(std::atomic<std::uint64_t>::is_always_lock_free && std::atomic<std::uint32_t>::is_always_lock_free,
+            "shared memory rings need address-free atomics.");
+        static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t));
+
+        inline void futex_wait(std::atomic<std::uint32_t>& word, std::uint32_t expected, long timeout_ns) noexcept {
+            timespec timeout{0, timeout_ns};
+            ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAIT, expected, &timeout, nullptr, 0);
+        }
+
+        inline void futex_wake_all(std::atomic<std::uint32_t>& word) noexcept {
+            ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+        }
+
+        inline bool process_alive(std::int32_t pid) noexcept {
+            return ::kill(static_cast<pid_t>(pid), 0) == 0 || errno != ESRCH;
+        }
+
+        // A named POSIX shared memory mapping. The creating side unlinks the name when it goes away;
+        // processes that still have it mapped keep reading until they let go.
+        class shm_segment {
+        public:
+            // Fails with EEXIST if the name is taken; the caller decides whether the holder is gone.
+            static shm_segment Create(const std::string& name, std::size_t size) {
+                int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+                if (fd < 0) {
+                    throw std::system_error(errno, std::generic_category(), "shm_open(" + name + ")");
+                }
+                if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+                    int error = errno;
+                    ::close(fd);
+                    ::shm_unlink(name.c_str());
+                    throw std::system_error(error, std::generic_category(), "ftruncate(" + name + ")");
+                }
+                return shm_segment(fd, size, name, true);
+            }
+
+            static shm_segment Open(const std::string& name) {
+                int fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+                if (fd < 0) {
+                    throw std::system_error(errno, std::generic_category(), "shm_open(" + name + ")");
+                }
+                struct stat info{};
+                if (::fstat(fd, &info) != 0) {
+                    int error = errno;
+                    ::close(fd);
+                    throw std::system_error(error, std::generic_category(), "fstat(" + name + ")");
+                }
+                return shm_segment(fd, static_cast<std::size_t>(info.st_size), name, false);
+            }
+
+            shm_segment(shm_segment&& other) noexcept
+                : data_(std::exchange(other.data_, nullptr)), size_(other.size_), name_(std::move(other.name_)), owner_(other.owner_) {}
+            shm_segment& operator=(shm_segment&&) = delete;
+
+            ~shm_segment() {
+                if (data_) {
+                    ::munmap(data_, size_);
+                    if (owner_) {
+                        ::shm_unlink(name_.c_str());
+                    }
+                }
+            }
+
+            void*       data() const noexcept { return data_; }
+            std::size_t size() const noexcept { return size_; }
+
+        private:
+            shm_segment(int fd, std::size_t size, std::string name, bool owner) : size_(size), name_(std::move(name)), owner_(owner) {
+                data_ = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                ::close(fd);
+                if (data_ == MAP_FAILED) {
+                    int error = errno;
+                    data_ = nullptr;
+                    if (owner_) {
+                        ::shm_unlink(name_.c_str());
+                    }
+                    throw std::system_error(error, std::generic_category(), "mmap(" + name_ + ")");
+                }
+            }
+
+            void*       data_ = nullptr;
+            std::size_t size_ = 0;
+            std::string name_;
+            bool        owner_ = false;
+        };
+
+        inline constexpr std::uint64_t shm_magic       = 0x4b4e4953474b4144ull; // "DAKGSINK"
+        inline constexpr std::uint32_t shm_version     = 1;
+        inline constexpr std::size_t   shm_max_readers = 64;
+
+        // How long a writer waits on an earlier sequence that is claimed but not published before it
+        // presumes that sequence's writer dead and publishes past it.
+        inline constexpr std::chrono::milliseconds shm_writer_stall{100};
+
+        struct alignas(cache_line) shm_reader {
+            std::atomic<std::int32_t>  pid_;  // zero while the slot is free, negated while its reader attaches
+            std::atomic<std::uint64_t> next_; // first sequence the reader has not finished with
+        };
+
+        struct shm_header {
+            std::atomic<std::uint64_t> magic_;     // written last by the creator
+            std::uint32_t              version_;
+            std::uint32_t              payload_size_;
+            std::uint64_t              signature_;
+            std::uint64_t              capacity_;
+            std::uint64_t              stride_;
+            std::int32_t               owner_pid_;
+            alignas(cache_line) std::atomic<std::uint64_t> claim_;
+            alignas(cache_line) std::atomic<std::uint64_t> cursor_;   // sequences below it are published
+            alignas(cache_line) std::atomic<std::uint32_t> epoch_;    // futex word readers sleep on
+            std::atomic<std::uint32_t>                     sleepers_;
+            alignas(cache_line) std::atomic<std::uint32_t> space_;    // futex word writers sleep on
+            std::atomic<std::uint32_t>                     blocked_;
+            shm_reader                                     readers_[shm_max_readers];
+        };
+
+        // Each cell carries the version of its last write: 2s+1 while sequence s is being written, 2s+2 once complete.
+        struct alignas(cache_line) shm_cell {
+            std::atomic<std::uint64_t> version_;
+        };
+
+        // Broadcast ring in shared memory. Any number of writer threads claim sequences; a writer reuses a cell
+        // only once the previous lap is published and every attached reader has finished with it, so readers
+        // consume records in place. Readers whose process died are reaped, and sequences whose writer died
+        // between claiming and publishing are skipped, so neither can stall writers for good.
+        template <typename Payload>
+        class shm_ring {
+        public:
+            static constexpr std::size_t stride = (sizeof(shm_cell) + Payload::size + cache_line - 1) / cache_line * cache_line;
+
+            static std::size_t Bytes(std::size_t capacity) noexcept {
+                return sizeof(shm_header) + capacity * stride;
+            }
+
+            // Creates the named ring. A name still held by a live publisher fails with EEXIST; one left
+            // behind by a publisher that died is replaced.
+            static std::unique_ptr<shm_ring> Create(const std::string& name, std::size_t capacity) {
+                for (bool retried = false;; retried = true) {
+                    try {
+                        return std::make_unique<shm_ring>(shm_segment::Create(name, Bytes(capacity)), true, capacity);
+                    }
+                    catch (const std::system_error& e) {
+                        if (retried || e.code() != std::errc::file_exists || !Abandoned(name)) {
+                            throw;
+                        }
+                        ::shm_unlink(name.c_str());
+                    }
+                }
+            }
+
+            shm_ring(shm_segment&& segment, bool create, std::size_t capacity) : segment_(std::move(segment)) {
+                header_ = static_cast<shm_header*>(segment_.data());
+                if (create) {
+                    header_->version_      = shm_version;
+                    header_->payload_size_ = static_cast<std::uint32_t>(Payload::size);
+                    header_->signature_    = Payload::signature;
+                    header_->capacity_     = capacity;
+                    header_->stride_       = stride;
+                    header_->owner_pid_    = static_cast<std::int32_t>(::getpid());
+                    header_->magic_.store(shm_magic, std::memory_order_release);
+                }
+                else if (segment_.size() < sizeof(shm_header)
+                    || header_->magic_.load(std::memory_order_acquire) != shm_magic
+                    || header_->version_ != shm_version || header_->signature_ != Payload::signature
+                    || header_->stride_ != stride || segment_.size() < Bytes(header_->capacity_)) {
+                    throw std::runtime_error("Can't attach to shared memory signal: the segment does not carry this signal.");
+                }
+                capacity_ = header_->capacity_;
+                mask_     = capacity_ - 1;
+                cells_    = reinterpret_cast<std::byte*>(header_ + 1);
+            }
+
+            template <typename...Args>
+            void Write(const Args&...args) noexcept {
+                std::uint64_t seq  = header_->claim_.fetch_add(1, std::memory_order_relaxed);
+                auto          cell = Cell(seq);
+                if (seq >= capacity_) {
+                    // The previous lap of this cell may still be unread, or in a slower writer's hands.
+                    std::uint64_t lap = seq - capacity_;
+                    Wait_for_readers(lap + 1);
+                    for (std::size_t round = 0; Cursor() <= lap; round++) {
+                        spin_pause(round);
+                    }
+                }
+
+                // The cell changes hands only here; a writer whose sequence was skipped while it stalled
+                // finds a later lap in it and gives up its record, which readers have counted as dropped.
+                std::uint64_t prior = cell->version_.load(std::memory_order_relaxed);
+                if (prior > 2 * seq || !cell->version_.compare_exchange_strong(prior, 2 * seq + 1, std::memory_order_relaxed)) {
+                    return;
+                }
+                std::atomic_thread_fence(std::memory_order_release);
+                Payload::Store(reinterpret_cast<std::byte*>(cell + 1), args...);
+                std::uint64_t writing = 2 * seq + 1;
+                if (!cell->version_.compare_exchange_strong(writing, 2 * seq + 2, std::memory_order_release)) {
+                    return;
+                }
+                Publish(seq);
+
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (header_->sleepers_.load(std::memory_order_relaxed)) {
+                    Wake();
+                }
+            }
+
+            // Runs f on sequence seq in place. False only if the cell does not hold seq: the reader attached
+            // while writers were a full lap ahead of the cursor, or seq was skipped after its writer stalled.
+            template <typename F>
+            bool Visit(std::uint64_t seq, F&& f) const {
+                auto cell = Cell(seq);
+                if (cell->version_.load(std::memory_order_acquire) != 2 * seq + 2) {
+                    return false;
+                }
+                Payload::Visit(reinterpret_cast<const std::byte*>(cell + 1), std::forward<F>(f));
+                return true;
+            }
+
+            std::uint64_t Cursor() const noexcept {
+                return header_->cursor_.load(std::memory_order_acquire);
+            }
+
+            // Claims a reader slot gated from the current cursor; returns the slot and the first sequence to read.
+            // The slot counts in Readers() only once that sequence is fixed, so a publisher that waits for its
+            // reader loses nothing to it.
+            std::pair<std::size_t, std::uint64_t> Attach() {
+                auto pid = static_cast<std::int32_t>(::getpid());
+                for (std::size_t i = 0; i < shm_max_readers; i++) {
+                    auto&        reader = header_->readers_[i];
+                    std::int32_t free   = 0;
+                    if (reader.pid_.load(std::memory_order_relaxed) == 0
+                        && reader.pid_.compare_exchange_strong(free, -pid, std::memory_order_acq_rel)) {
+                        // Writers gate on the slot from here on; the second store moves it up to where they are now.
+                        reader.next_.store(Cursor(), std::memory_order_seq_cst);
+                        std::uint64_t next = Cursor();
+                        reader.next_.store(next, std::memory_order_release);
+                        reader.pid_.store(pid, std::memory_order_release);
+                        return {i, next};
+                    }
+                }
+                throw std::runtime_error("Can't attach to shared memory signal: every reader slot is taken.");
+            }
+
+            void Detach(std::size_t slot) noexcept {
+                header_->readers_[slot].pid_.store(0, std::memory_order_release);
+                Wake_writers();
+            }
+
+            // Hands every cell below next back to the writers.
+            void Release(std::size_t slot, std::uint64_t next) noexcept {
+                header_->readers_[slot].next_.store(next, std::memory_order_release);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (header_->blocked_.load(std::memory_order_relaxed)) {
+                    Wake_writers();
+                }
+            }
+
+            std::size_t Readers() const noexcept {
+                std::size_t count = 0;
+                for (auto& reader : header_->readers_) {
+                    count += reader.pid_.load(std::memory_order_acquire) > 0;
+                }
+                return count;
+            }
+
+            // Spins briefly for sub-microsecond hand-off, then sleeps on the futex for at most timeout_ns.
+            void Wait(std::uint64_t next, long timeout_ns) noexcept {
+                for (std::size_t round = 0; round < 2048; round++) {
+                    if (Cursor() > next) {
+                        return;
+                    }
+                    spin_pause(round < 64 ? round : 0);
+                }
+                std::uint32_t epoch = header_->epoch_.load(std::memory_order_acquire);
+                header_->sleepers_.fetch_add(1, std::memory_order_seq_cst);
+                if (header_->cursor_.load(std::memory_order_seq_cst) <= next) {
+                    futex_wait(header_->epoch_, epoch, timeout_ns);
+                }
+                header_->sleepers_.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            void Wake() noexcept {
+                header_->epoch_.fetch_add(1, std::memory_order_release);
+                futex_wake_all(header_->epoch_);
+            }
+
+        private:
+            static bool Abandoned(const std::string& name) {
+                try {
+                    shm_segment existing = shm_segment::Open(name);
+                    auto header = static_cast<const shm_header*>(existing.data());
+                    return existing.size() >= sizeof(shm_header)
+                        && header->magic_.load(std::memory_order_acquire) == shm_magic
+                        && !process_alive(header->owner_pid_);
+                }
+                catch (const std::system_error&) {
+                    return false;
+                }
+            }
+
+            shm_cell* Cell(std::uint64_t seq) const noexcept {
+                return reinterpret_cast<shm_cell*>(cells_ + (seq & mask_) * stride);
+            }
+
+            std::uint64_t Slowest() const noexcept {
+                std::uint64_t least = UINT64_MAX;
+                for (auto& reader : header_->readers_) {
+                    if (reader.pid_.load(std::memory_order_acquire) != 0) {
+                        least = std::min(least, reader.next_.load(std::memory_order_acquire));
+                    }
+                }
+                return least;
+            }
+
+            // Frees the slots of readers whose process is gone, so they stop gating writers.
+            void Reap() noexcept {
+                for (auto& reader : header_->readers_) {
+                    std::int32_t pid = reader.pid_.load(std::memory_order_acquire);
+                    if (pid != 0 && !process_alive(pid < 0 ? -pid : pid)) {
+                        reader.pid_.compare_exchange_strong(pid, 0, std::memory_order_acq_rel);
+                    }
+                }
+            }
+
+            // Moves the cursor past seq once every earlier sequence is published. An earlier sequence that stays
+            // unpublished for shm_writer_stall, while this one is written, belongs to a writer that died or was
+            // stopped after claiming it: its readers have nothing else to wait on, so it is skipped.
+            void Publish(std::uint64_t seq) noexcept {
+                std::uint64_t cursor = Cursor();
+                auto          since  = std::chrono::steady_clock::time_point{};
+                for (std::size_t round = 0; cursor < seq; round++) {
+                    spin_pause(round);
+                    if (std::uint64_t now = Cursor(); now != cursor) {
+                        cursor = now;
+                        since  = {};
+                        round  = 0;
+                    }
+                    else if (round >= 64 && round % 64 == 0) {
+                        auto clock = std::chrono::steady_clock::now();
+                        if (since == std::chrono::steady_clock::time_point{}) {
+                            since = clock;
+                        }
+                        else if (clock - since >= shm_writer_stall) {
+                            header_->cursor_.compare_exchange_strong(cursor, cursor + 1, std::memory_order_acq_rel);
+                            cursor = Cursor();
+                            since  = {};
+                        }
+                    }
+                }
+                if (cursor == seq) {
+                    header_->cursor_.compare_exchange_strong(cursor, seq + 1, std::memory_order_release);
+                }
+            }
+
+            void Wait_for_readers(std::uint64_t bound) noexcept {
+                if (gate_.load(std::memory_order_relaxed) >= bound) [[likely]] {
+                    return;
+                }
+                for (std::size_t round = 0;; round++) {
+                    std::uint64_t slowest = Slowest();
+                    if (slowest >= bound) {
+                        gate_.store(slowest, std::memory_order_relaxed);
+                        return;
+                    }
+                    if (round < 2048) {
+                        spin_pause(round < 64 ? round : 0);
+                        continue;
+                    }
+                    Reap();
+                    std::uint32_t epoch = header_->space_.load(std::memory_order_acquire);
+                    header_->blocked_.fetch_add(1, std::memory_order_seq_cst);
+                    if (Slowest() < bound) {
+                        futex_wait(header_->space_, epoch, 1'000'000);
+                    }
+                    header_->blocked_.fetch_sub(1, std::memory_order_relaxed);
+                }
+            }
+
+            void Wake_writers() noexcept {
+                header_->space_.fetch_add(1, std::memory_order_release);
+                futex_wake_all(header_->space_);
+            }
+
+            shm_segment                segment_;
+            shm_header*                header_   = nullptr;
+            std::byte*                 cells_    = nullptr;
+            std::uint64_t              capacity_ = 0;
+            std::uint64_t              mask_     = 0;
+            std::atomic<std::uint64_t> gate_     = 0; // cached slowest reader of this process's writers
+        };
+    }
+
+    using detail::shm_transportable;
+
+    // Writes a signal into a named shared memory ring. Emit into it directly with publish(), or connect
+    // forward() to an emitter so its emissions cross the process boundary; the publisher must outlive that connection.
+    // A full ring blocks the writer until the slowest attached reader catches up.
+    template <shm_transportable Signal>
+    class shm_publisher {
+        using payload = detail::shm_payload<detail::signal_degradation_t<Signal>>;
+        using ring    = detail::shm_ring<payload>;
+
+    public:
+        explicit shm_publisher(const std::string& name, std::size_t capacity = 4096)
+            : ring_(ring::Create(name, Checked(capacity))) {}
+
+        void publish(const Signal& signal) noexcept {
+            std::apply([this](const auto&...args) { ring_->Write(args...); }, signal.args_);
+        }
+
+        auto forward() const {
+            return stdexec::then([ring = ring_.get()](const auto&...args) noexcept { ring->Write(args...); });
+        }
+
+        // Attached readers, across all processes.
+        std::size_t readers() const noexcept {
+            return ring_->Readers();
+        }
+
+    private:
+        static std::size_t Checked(std::size_t capacity) {
+            if (capacity == 0 || (capacity & (capacity - 1)) != 0) {
+                throw std::invalid_argument("shm_publisher capacity must be a power of two.");
+            }
+            return capacity;
+        }
+
+        std::unique_ptr<ring> ring_;
+    };
+
+    // An emitter fed from a named shared memory ring. It attaches at the current cursor when constructed;
+    // start() then runs a reader thread that broadcasts every record from there on to the slots connected
+    // here, straight from the ring cell, handing the cell back once the broadcast returns. Connect the slots
+    // before start(): until then records wait in the ring, and a full ring blocks the writers. Records
+    // that could not be read are counted in dropped().
+    template <shm_transportable Signal>
+    class shm_subscriber : public enable_signal<Signal> {
+        using payload = detail::shm_payload<detail::signal_degradation_t<Signal>>;
+        using ring    = detail::shm_ring<payload>;
+
+    public:
+        explicit shm_subscriber(const std::string& name)
+            : ring_(std::make_unique<ring>(detail::shm_segment::Open(name), false, 0)) {
+            std::tie(slot_, next_) = ring_->Attach();
+        }
+
+        ~shm_subscriber() {
+            if (reader_.joinable()) {
+                stop_.store(true, std::memory_order_release);
+                ring_->Wake();
+                reader_.join();
+            }
+            ring_->Detach(slot_);
+        }
+
+        // Starts delivery. Later calls do nothing.
+        void start() {
+            if (!reader_.joinable()) {
+                reader_ = std::thread([this] { Run(); });
+            }
+        }
+
+        std::uint64_t dropped() const noexcept {
+            return dropped_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        void Run() {
+            detail::emitter_unit<Signal>* unit = this;
+            auto deliver = [&](const auto&...args) { detail::unit_access::Broadcast(unit, this->Scope(), args...); };
+            while (!stop_.load(std::memory_order_acquire)) {
+                std::uint64_t available = ring_->Cursor();
+                if (available == next_) {
+                    ring_->Wait(next_, 50'000'000);
+                    continue;
+                }
+                for (; next_ < available && !stop_.load(std::memory_order_relaxed); next_++) {
+                    if (!ring_->Visit(next_, deliver)) {
+                        dropped_.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+                ring_->Release(slot_, next_);
+            }
+        }
+
+        std::unique_ptr<ring>      ring_;
+        std::size_t                slot_ = 0;
+        std::uint64_t              next_ = 0;
+        std::atomic_bool           stop_    = false;
+        std::atomic<std::uint64_t> dropped_ = 0;
+        std::thread                reader_;
+    };
+}
+
+#endif // __linux__
+
+#endif // !DAKING_SIGNAL_SHM_HPP
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <stdexec/execution.hpp>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "signal_arena.hpp"
+
+#if defined(__linux__)
+
+using namespace daking;
+using namespace stdexec;
+
+// --- Signal Definitions ---
+namespace {
+
+struct Sweep : daking::signal<int> { using base::base; };
+struct Bell : daking::signal<void> {};
+
+struct Walker : enable_signal<Sweep, Bell> {
+    explicit Walker(std::pmr::memory_resource* resource) : enable_signal<Sweep, Bell>(resource) {}
+};
+
+}
+
+// 1. Small blocks are carved from 2 MiB aligned regions and pooled on the way back
+TEST(HugePageArenaTest, AllocateAndReuse) {
+    huge_page_arena arena;
+    void* first = arena.allocate(256, 64);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(first) % 64, 0u);
+    EXPECT_GE(arena.mapped_bytes(), 2u << 20);
+    EXPECT_EQ(arena.mapped_bytes() % (2u << 20), 0u);
+    EXPECT_LE(arena.huge_bytes(), arena.mapped_bytes());
+
+    std::size_t mapped = arena.mapped_bytes();
+    arena.deallocate(first, 256, 64);
+    for (int i = 0; i < 1000; i++) {
+        void* block = arena.allocate(256, 64);
+        arena.deallocate(block, 256, 64);
+    }
+    EXPECT_EQ(arena.mapped_bytes(), mapped);
+}
+
+// 2. Large blocks get mappings of their own, unmapped on deallocate once
+TEST(HugePageArenaTest, LargeBlocksMappedDirectly) {
+    huge_page_arena arena;
+    std::size_t size = 3u << 20;
+    auto* block = static_cast<std::byte*>(arena.allocate(size, alignof(std::max_align_t)));
+    block[0] = block[size - 1] = std::byte{1};
+    std::size_t mapped = arena.mapped_bytes();
+    EXPECT_GE(mapped, size);
+
+    arena.deallocate(block, size, alignof(std::max_align_t));
+    EXPECT_LT(arena.mapped_bytes(), mapped);
+
+    // A block the arena does not own is ignored
+    std::size_t remaining = arena.mapped_bytes();
+    arena.deallocate(block, size, alignof(std::max_align_t));
+    EXPECT_EQ(arena.mapped_bytes(), remaining);
+}
+
+// 3. An emitter runs entirely out of the arena
+TEST(HugePageArenaTest, BacksAnEmitter) {
+    huge_page_arena arena;
+    std::atomic<int> total = 0;
+    {
+        Walker walker(&arena);
+        auto adder = [&total] { return then([&total](int n) { total += n; }); };
+
+        std::vector<decltype(daking::connect<Sweep>(walker, adder()))> cons;
+        for (int i = 0; i < 100; i++) {
+            cons.push_back(daking::connect<Sweep>(walker, adder()));
+        }
+        daking::connect<Bell>(walker, just());
+        EXPECT_GT(arena.mapped_bytes(), 0u);
+
+        for (int i = 0; i < 50; i++) {
+            daking::disconnect<Sweep>(walker, cons[i]);
+        }
+        daking::emit(Sweep{2}, broadcast, walker);
+        daking::emit(Bell{}, broadcast, walker);
+    }
+    EXPECT_EQ(total.load(), 100);
+}
+
+// 4. One arena per online node; the local one is among them
+TEST(HugePageArenaTest, NumaArenas) {
+    numa_arenas arenas;
+    ASSERT_GE(arenas.nodes(), 1u);
+    EXPECT_EQ(arenas.for_node(0).node(), 0);
+    EXPECT_THROW(arenas.for_node(static_cast<int>(arenas.nodes())), std::out_of_range);
+    EXPECT_THROW(arenas.for_node(-1), std::out_of_range);
+
+    huge_page_arena& local = arenas.local();
+    EXPECT_GE(local.node(), 0);
+    EXPECT_LT(static_cast<std::size_t>(local.node()), arenas.nodes());
+
+    Walker walker(&local);
+    int sweeps = 0;
+    daking::connect<Sweep>(walker, then([&sweeps](int) { sweeps++; }));
+    daking::emit(Sweep{1}, broadcast, walker);
+    EXPECT_EQ(sweeps, 1);
+}
+
+#endif // __linux__
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include <stdexec/execution.hpp>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "signal_bridge.hpp"
+
+#if defined(__linux__)
+
+using namespace daking;
+using namespace stdexec;
+
+// --- Signal Definitions ---
+namespace {
+
+struct Ticker : daking::signal<std::uint64_t, std::string, double> { using base::base; };
+struct Halt   : daking::signal<void> {};
+
+struct Feed : enable_signal<Ticker, Halt> {};
+
+template <typename F>
+static bool wait_until(F&& done) {
+    for (int i = 0; i < 5000 && !done(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return done();
+}
+
+}
+
+// 1. Frames cross in emission order, many per packet
+TEST(BridgeTest, RoundTrip) {
+    auto [near, far] = seqpacket_socket::pair();
+    Feed local, remote;
+
+    std::vector<std::uint64_t> ids;
+    std::atomic<int> halts = 0;
+    daking::connect<Ticker>(remote, then([&](std::uint64_t id, const std::string& symbol, double px) {
+        EXPECT_EQ(symbol, "MSFT");
+        EXPECT_EQ(px, id * 0.5);
+        ids.push_back(id);
+    }));
+    daking::connect<Halt>(remote, just() | then([&]() { halts++; }));
+
+    bridge_receiver<Ticker, Halt> receiver(remote, std::move(far));
+    {
+        bridge_sender<Ticker, Halt> sender(local, std::move(near));
+        for (std::uint64_t i = 0; i < 20000; i++) {
+            daking::emit(Ticker{i, "MSFT", i * 0.5}, broadcast, local);
+        }
+        daking::emit(Halt{}, broadcast, local);
+        EXPECT_EQ(sender.dropped(), 0);
+        EXPECT_TRUE(wait_until([&] { return sender.sent() == 20001; }));
+        EXPECT_LT(sender.packets(), 20001);
+    }
+
+    ASSERT_TRUE(wait_until([&] { return receiver.received() == 20001; }));
+    ASSERT_EQ(ids.size(), 20000);
+    for (std::uint64_t i = 0; i < ids.size(); i++) {
+        ASSERT_EQ(ids[i], i);
+    }
+    EXPECT_EQ(halts, 1);
+    EXPECT_EQ(receiver.malformed(), 0);
+    EXPECT_TRUE(wait_until([&] { return !receiver.connected(); }));
+}
+
+// 2. The sender never has more frames in flight than the receiver granted, and blocks when its queue is full
+TEST(BridgeTest, CreditFlowControl) {
+    auto [near, far] = seqpacket_socket::pair();
+    Feed local, remote;
+
+    std::atomic_bool release = false;
+    std::atomic<int> delivered = 0;
+    daking::connect<Ticker>(remote, then([&](std::uint64_t, const std::string&, double) {
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+        delivered++;
+    }));
+
+    bridge_receiver<Ticker, Halt> receiver(remote, std::move(far), 4);
+    bridge_sender<Ticker, Halt> sender(local, std::move(near), 8);
+
+    std::atomic<int> emitted = 0;
+    std::thread producer([&] {
+        for (std::uint64_t i = 0; i < 100; i++) {
+            daking::emit(Ticker{i, "IBM", 1.0}, broadcast, local);
+            emitted++;
+        }
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_LE(sender.sent(), 4);
+    EXPECT_LT(emitted.load(), 100); // at most the staged queue, the batch being sent and the window
+    release = true;
+    producer.join();
+
+    EXPECT_TRUE(wait_until([&] { return delivered == 100; }));
+    EXPECT_EQ(sender.sent(), 100);
+}
+
+// 3. Connecting by path, and refusing a peer with a different signal list
+TEST(BridgeTest, ListenerAndHandshake) {
+    std::string path = "/tmp/daking_bridge_" + std::to_string(::getpid()) + ".sock";
+    seqpacket_listener listener(path);
+    Feed local, remote;
+
+    std::atomic<int> quotes = 0;
+    daking::connect<Ticker>(remote, then([&](std::uint64_t, const std::string&, double) { quotes++; }));
+
+    std::unique_ptr<bridge_receiver<Ticker, Halt>> receiver;
+    std::thread acceptor([&] { receiver = std::make_unique<bridge_receiver<Ticker, Halt>>(remote, listener.accept()); });
+    {
+        bridge_sender<Ticker, Halt> sender(local, seqpacket_socket::connect(path));
+        acceptor.join();
+        daking::emit(Ticker{1, "X", 1.0}, broadcast, local);
+    }
+    EXPECT_TRUE(wait_until([&] { return quotes == 1; }));
+
+    std::unique_ptr<bridge_receiver<Halt, Ticker>> mismatched;
+    acceptor = std::thread([&] { mismatched = std::make_unique<bridge_receiver<Halt, Ticker>>(remote, listener.accept()); });
+    EXPECT_THROW((bridge_sender<Ticker, Halt>(local, seqpacket_socket::connect(path))), std::runtime_error);
+    acceptor.join();
+}
+
+// 4. A receiver that stops reading holds up the sender's destructor, and its blocked emitters, only for the linger
+TEST(BridgeTest, LingerBoundsClose) {
+    auto [near, far] = seqpacket_socket::pair();
+    Feed local;
+    // A peer that greets with a window of two frames and then never reads or grants credit again
+    ASSERT_TRUE(detail::bridge_send(far.native_handle(), {detail::bridge_hello, 2, detail::codec_signature<Ticker, Halt>}));
+
+    std::atomic<int> emitted = 0;
+    std::thread producer;
+    {
+        bridge_sender<Ticker, Halt> sender(local, std::move(near), 4, std::chrono::milliseconds(100));
+        producer = std::thread([&] {
+            for (std::uint64_t i = 0; i < 20; i++) {
+                daking::emit(Ticker{i, "T", 1.0}, broadcast, local);
+                emitted++;
+            }
+        });
+        EXPECT_TRUE(wait_until([&] { return sender.sent() == 2; }));
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        EXPECT_LT(emitted.load(), 20); // blocked on the full staging queue
+    }
+    producer.join();
+    EXPECT_EQ(emitted.load(), 20);
+}
+
+#endif
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include <stdexec/execution.hpp>
+#include <chrono>
+#include <thread>
+
+#include "signal.hpp"
+
+using namespace daking;
+using namespace stdexec;
+using namespace std::chrono_literals;
+
+// --- Signal Definitions ---
+namespace {
+
+struct Mark       : daking::signal<double> { using base::base; };
+struct SessionEnd : daking::signal<void> {};
+
+struct Pricer : enable_signal<Mark, SessionEnd> {};
+
+}
+
+// 1. A closed emitter takes no emission and no connection
+TEST(CloseTest, StopsAccepting) {
+    Pricer pricer;
+    int quotes = 0, ends = 0;
+
+    daking::connect<Mark>(pricer, then([&](double) { quotes++; }));
+    daking::connect<SessionEnd>(pricer, just() | then([&]() { ends++; }));
+    daking::emit(Mark{1.0}, broadcast, pricer);
+
+    stdexec::sync_wait(daking::close(pricer));
+
+    daking::emit(Mark{2.0}, broadcast, pricer);
+    SessionEnd{} >> daking::emit(broadcast, pricer);
+    EXPECT_THROW(daking::connect<Mark>(pricer, then([](double) {})), std::runtime_error);
+
+    EXPECT_EQ(quotes, 1);
+    EXPECT_EQ(ends, 0);
+    stdexec::sync_wait(daking::close(pricer)); // Closing twice is harmless
+}
+
+// 2. Timers stop with the emitter
+TEST(CloseTest, CancelsTimers) {
+    Pricer pricer;
+    std::atomic<int> ticks = 0;
+
+    daking::connect<Mark>(pricer, then([&](double) { ticks++; }));
+    auto timer = daking::emit_every(5ms, Mark{1.0}, broadcast, pricer);
+    while (ticks.load() == 0) {
+        std::this_thread::sleep_for(1ms);
+    }
+
+    stdexec::sync_wait(daking::close(pricer));
+    EXPECT_FALSE(timer.active());
+    int seen = ticks.load();
+    std::this_thread::sleep_for(30ms);
+    EXPECT_EQ(ticks.load(), seen);
+}
+
+// 3. Many emitters close together, and grouped ones complete at once
+TEST(CloseTest, ComposesWithWhenAll) {
+    scope_group group;
+    struct Member : enable_signal<Mark> {
+        explicit Member(scope_group& g) : enable_signal<Mark>(g) {}
+    };
+    Pricer a, b;
+    Member c(group);
+    int quotes = 0;
+
+    daking::connect<Mark>(c, then([&](double) { quotes++; }));
+    daking::emit(Mark{1.0}, broadcast, c);
+
+    stdexec::sync_wait(stdexec::when_all(daking::close(a), daking::close(b), daking::close(c)));
+    daking::emit(Mark{1.0}, broadcast, c);
+    stdexec::sync_wait(group.close());
+    EXPECT_EQ(quotes, 1);
+}
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include <stdexec/execution.hpp>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "signal_codec.hpp"
+
+using namespace daking;
+using namespace stdexec;
+
+// --- Signal Definitions ---
+namespace {
+
+enum class Side : std::uint8_t { Buy, Sell };
+struct Point { float x_, y_; };
+
+struct Execution : daking::signal<std::uint64_t, double, Side> { using base::base; };
+struct Label     : daking::signal<std::string, std::vector<int>, std::vector<std::string>> { using base::base; };
+struct Nested    : daking::signal<std::tuple<int, std::string>, std::pair<Point, std::optional<double>>> { using base::base; };
+struct Count     : daking::signal<int> {};
+struct Pulse     : daking::signal<void> {};
+struct Bid       : daking::keyed_signal<std::string, double> { using base::base; };
+struct Flag      : daking::signal<bool> {};
+struct Word      : daking::signal<std::string> {};
+struct Chars     : daking::signal<std::vector<char>> {};
+
+template <typename Signal>
+static std::vector<std::byte> encode(const Signal& signal) {
+    std::vector<std::byte> bytes;
+    codec<Signal>::encode(signal, bytes);
+    EXPECT_EQ(bytes.size(), codec<Signal>::size(signal));
+    return bytes;
+}
+
+}
+
+// 1. Trivially copyable arguments are laid out back to back, little-endian
+TEST(CodecTest, FixedWidthLayout) {
+    Execution fill{0x0102030405060708ull, 2.5, Side::Sell};
+    auto bytes = encode(fill);
+
+    ASSERT_EQ(bytes.size(), sizeof(std::uint64_t) + sizeof(double) + sizeof(Side));
+    EXPECT_EQ(bytes[0], std::byte{0x08});
+    EXPECT_EQ(bytes[7], std::byte{0x01});
+    EXPECT_EQ(bytes[16], std::byte{1});
+
+    auto decoded = codec<Execution>::decode(bytes);
+    EXPECT_EQ(std::get<0>(decoded.args_), 0x0102030405060708ull);
+    EXPECT_EQ(std::get<1>(decoded.args_), 2.5);
+    EXPECT_EQ(std::get<2>(decoded.args_), Side::Sell);
+}
+
+// 2. Strings and vectors carry a varint count
+TEST(CodecTest, LengthPrefixedContainers) {
+    std::string long_text(300, 'x');
+    Label label{long_text, std::vector<int>{1, -2, 3}, std::vector<std::string>{"a", "", "bc"}};
+    auto bytes = encode(label);
+
+    EXPECT_EQ(bytes[0], std::byte{0xac}); // 300 = 0b10'0101100
+    EXPECT_EQ(bytes[1], std::byte{0x02});
+
+    auto decoded = codec<Label>::decode(bytes);
+    EXPECT_EQ(decoded.args_, label.args_);
+
+    Label empty{std::string{}, std::vector<int>{}, std::vector<std::string>{}};
+    EXPECT_EQ(encode(empty).size(), 3);
+    EXPECT_EQ(codec<Label>::decode(encode(empty)).args_, empty.args_);
+}
+
+// 3. Nested tuples, pairs and optionals round-trip
+TEST(CodecTest, NestedValues) {
+    Nested nested{std::tuple<int, std::string>{7, "seven"}, std::pair<Point, std::optional<double>>{Point{1.f, 2.f}, 0.5}};
+    auto decoded = codec<Nested>::decode(encode(nested));
+
+    EXPECT_EQ(std::get<0>(decoded.args_), std::get<0>(nested.args_));
+    auto& [point, value] = std::get<1>(decoded.args_);
+    EXPECT_EQ(point.x_, 1.f);
+    EXPECT_EQ(point.y_, 2.f);
+    EXPECT_EQ(value, 0.5);
+
+    std::get<1>(nested.args_).second.reset();
+    EXPECT_FALSE(std::get<1>(codec<Nested>::decode(encode(nested)).args_).second.has_value());
+}
+
+// 4. Aggregate, void and keyed signals
+TEST(CodecTest, SignalShapes) {
+    EXPECT_EQ(std::get<0>(codec<Count>::decode(encode(Count{42})).args_), 42);
+
+    EXPECT_TRUE(encode(Pulse{}).empty());
+    EXPECT_NO_THROW(codec<Pulse>::decode({}));
+
+    auto quote = codec<Bid>::decode(encode(Bid{std::string("AAPL"), 189.5}));
+    EXPECT_EQ(std::get<0>(quote.args_), "AAPL");
+    EXPECT_EQ(std::get<1>(quote.args_), 189.5);
+}
+
+// 5. Malformed input is rejected instead of read past its end
+TEST(CodecTest, MalformedInput) {
+    auto bytes = encode(Label{std::string("text"), std::vector<int>{1, 2}, std::vector<std::string>{"x"}});
+
+    for (std::size_t size = 0; size < bytes.size(); size++) {
+        EXPECT_THROW(codec<Label>::decode(std::span(bytes.data(), size)), std::runtime_error);
+    }
+    bytes.push_back(std::byte{0});
+    EXPECT_THROW(codec<Label>::decode(bytes), std::runtime_error);
+
+    std::vector<std::byte> huge(10, std::byte{0xff});
+    EXPECT_THROW(codec<Label>::decode(huge), std::runtime_error);
+    EXPECT_THROW(codec<Pulse>::decode(bytes), std::runtime_error);
+}
+
+// 6. Encoding into a caller-provided buffer appends nothing beyond size()
+TEST(CodecTest, RawBuffer) {
+    Execution fill{1ull, 1.0, Side::Buy};
+    std::byte buffer[64];
+    std::fill(std::begin(buffer), std::end(buffer), std::byte{0xee});
+
+    auto written = codec<Execution>::encode(fill, buffer);
+    EXPECT_EQ(written, codec<Execution>::size(fill));
+    EXPECT_EQ(buffer[written], std::byte{0xee});
+    EXPECT_EQ(codec<Execution>::decode(std::span<const std::byte>(buffer, written)).args_, fill.args_);
+}
+
+// 7. Ingress by numeric id: the id is the signal's position in enable_signal<...>
+struct Ingress : enable_signal<Execution, Label, Pulse> {};
+
+static_assert(signal_id<Execution, Ingress> == 0);
+static_assert(signal_id<Pulse, Ingress> == 2);
+
+TEST(CodecTest, EmitById) {
+    Ingress ingress;
+    std::vector<std::string> seen;
+    daking::connect<Execution>(ingress, then([&](std::uint64_t id, double, Side) { seen.push_back("fill" + std::to_string(id)); }));
+    daking::connect<Label>(ingress, then([&](const std::string& text, const std::vector<int>&, const std::vector<std::string>&) { seen.push_back(text); }));
+    daking::connect<Pulse>(ingress, just() | then([&]() { seen.push_back("pulse"); }));
+
+    auto fill  = encode(Execution{7ull, 1.0, Side::Buy});
+    auto label = encode(Label{std::string("hello"), std::vector<int>{}, std::vector<std::string>{}});
+
+    daking::emit_by_id(signal_id<Label, Ingress>, label, broadcast, ingress);
+    daking::emit_by_id(0, fill, broadcast, ingress);
+    daking::emit_by_id(2, std::span<const std::byte>{}, broadcast, &ingress);
+    EXPECT_EQ(seen, (std::vector<std::string>{"hello", "fill7", "pulse"}));
+
+    EXPECT_THROW(daking::emit_by_id(3, fill, broadcast, ingress), std::runtime_error);
+    EXPECT_THROW(daking::emit_by_id(1, fill, broadcast, ingress), std::runtime_error);
+    EXPECT_EQ(seen.size(), 3);
+}
+
+// 8. Signatures tell apart wire formats of equal size, and bools decode from any byte
+TEST(CodecTest, SignatureAndBool) {
+    EXPECT_NE((detail::codec_signature<Word>), (detail::codec_signature<Chars>));
+    EXPECT_NE((detail::codec_signature<Word, Chars>), (detail::codec_signature<Chars, Word>));
+    EXPECT_EQ((detail::codec_signature<Word, Count>), (detail::codec_signature<Word, Count>));
+
+    std::vector<std::byte> bytes{std::byte{2}};
+    EXPECT_TRUE(std::get<0>(codec<Flag>::decode(bytes).args_));
+    bytes[0] = std::byte{0};
+    EXPECT_FALSE(std::get<0>(codec<Flag>::decode(bytes).args_));
+}
@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+#include <stdexec/execution.hpp>
+#include <atomic>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+#include "signal.hpp"
+
+using namespace daking;
+using namespace stdexec;
+
+// --- Signal Definitions ---
+namespace {
+
+struct Trade : daking::combining_signal<int, int> { using base::base; };
+struct Burst : daking::combining_signal<int> { 
+    using base::base; 
+    static constexpr std::size_t combining_records = 2;
+};
+
+struct Exchange : enable_signal<Trade, Burst> {
+    Exchange() = default;
+    explicit Exchange(std::pmr::memory_resource* resource) : enable_signal<Trade, Burst>(resource) {}
+};
+
+// Forwards to the global heap and counts what passes through.
+struct metered_resource : std::pmr::memory_resource {
+    std::atomic<std::size_t> allocations = 0;
+    std::atomic<std::size_t> in_use      = 0;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        allocations++;
+        in_use += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override {
+        in_use -= bytes;
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+}
+
+// 1. One producer sees plain broadcast behaviour: every slot, in emission order
+TEST(CombiningTest, SingleProducer) {
+    Exchange exchange;
+    std::vector<int> first, second;
+    auto con = daking::connect<Trade>(exchange, then([&](int, int seq) { first.push_back(seq); }));
+    daking::connect<Trade>(exchange, then([&](int, int seq) { second.push_back(seq); }));
+
+    for (int i = 0; i < 5; i++) {
+        daking::emit(Trade{0, i}, broadcast, exchange);
+    }
+    con.disable();
+    daking::emit(Trade{0, 5}, broadcast, exchange);
+    daking::disconnect<Trade>(exchange, con);
+    daking::emit(Trade{0, 6}, broadcast, exchange);
+
+    EXPECT_EQ(first, (std::vector<int>{0, 1, 2, 3, 4}));
+    EXPECT_EQ(second, (std::vector<int>{0, 1, 2, 3, 4, 5, 6}));
+}
+
+// 2. Under contention every emission reaches every slot once, each producer's in its own order
+TEST(CombiningTest, ContendedProducers) {
+    constexpr int producers = 8, emissions = 2000, slots = 4;
+    Exchange exchange;
+
+    struct alignas(64) tally {
+        std::atomic<long> sum = 0;
+        int               last[producers];
+        std::atomic<bool> ordered = true;
+    };
+    std::vector<tally> tallies(slots);
+    for (auto& t : tallies) {
+        std::fill(std::begin(t.last), std::end(t.last), -1);
+        daking::connect<Trade>(exchange, then([&t](int producer, int seq) {
+            // A producer's emissions are dispatched one at a time, so its own entry is never raced.
+            if (seq != t.last[producer] + 1) {
+                t.ordered = false;
+            }
+            t.last[producer] = seq;
+            t.sum += seq;
+        }));
+    }
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&exchange, p] {
+            for (int i = 0; i < emissions; i++) {
+                daking::emit(Trade{p, i}, broadcast, exchange);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    for (auto& t : tallies) {
+        EXPECT_EQ(t.sum.load(), long(producers) * emissions * (emissions - 1) / 2);
+        EXPECT_TRUE(t.ordered.load());
+    }
+}
+
+// 3. Threads beyond combining_records broadcast directly
+TEST(CombiningTest, MoreThreadsThanRecords) {
+    Exchange exchange;
+    std::atomic<long> total = 0;
+    daking::connect<Burst>(exchange, then([&](int n) { total += n; }));
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < 6; p++) {
+        threads.emplace_back([&exchange] {
+            for (int i = 1; i <= 1000; i++) {
+                daking::emit(Burst{i}, broadcast, exchange);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    EXPECT_EQ(total.load(), 6 * 1000 * 1001 / 2);
+}
+
+// 4. A slot running inside a combined pass may emit combining signals again
+TEST(CombiningTest, EmitFromSlot) {
+    Exchange exchange;
+    std::atomic<int> bursts = 0, trades = 0;
+    daking::connect<Trade>(exchange, then([&](int producer, int seq) {
+        trades++;
+        if (producer == 0) {
+            daking::emit(Trade{1, seq}, broadcast, exchange);
+            daking::emit(Burst{seq}, broadcast, exchange);
+        }
+    }));
+    daking::connect<Burst>(exchange, then([&](int) { bursts++; }));
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < 4; p++) {
+        threads.emplace_back([&exchange] {
+            for (int i = 0; i < 500; i++) {
+                daking::emit(Trade{0, i}, broadcast, exchange);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    EXPECT_EQ(trades.load(), 4 * 500 * 2);
+    EXPECT_EQ(bursts.load(), 4 * 500);
+}
+
+// 5. Records come from the emitter's resource, and only once producers contend
+TEST(CombiningTest, RecordsFromResource) {
+    metered_resource meter;
+    {
+        Exchange exchange(&meter);
+        std::atomic<long> total = 0;
+        daking::connect<Trade>(exchange, then([&](int, int seq) { total += seq; }));
+
+        std::size_t connected = meter.allocations.load();
+        for (int i = 0; i < 1000; i++) {
+            daking::emit(Trade{0, i}, broadcast, exchange);
+        }
+        EXPECT_EQ(meter.allocations.load(), connected); // Uncontended: no records yet
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < 4; p++) {
+            threads.emplace_back([&exchange, p] {
+                for (int i = 0; i < 2000; i++) {
+                    daking::emit(Trade{p, i}, broadcast, exchange);
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        EXPECT_EQ(total.load(), 999L * 1000 / 2 + 4L * 1999 * 2000 / 2);
+    }
+    EXPECT_EQ(meter.in_use.load(), 0u);
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <stdexec/execution.hpp>
+#include <string>
+#include <vector>
+
+#include "signal.hpp"
+
+using namespace daking;
+using namespace stdexec;
+
+// --- Signal Definitions ---
+namespace {
+
+struct Filled   : daking::signal<std::uint64_t, double> { using base::base; };
+struct Rejected : daking::signal<std::string> { using base::base; };
+struct Expired  : daking::signal<void> {};
+
+struct OrderState : compact_emitter<Filled, Rejected, Expired> {
+    std::uint64_t id_ = 0;
+};
+
+}
+
+// 1. An instance is one pointer until something connects to it
+TEST(CompactEmitterTest, Footprint) {
+    static_assert(sizeof(compact_emitter<Filled, Rejected, Expired>) == sizeof(void*));
+
+    OrderState order;
+    EXPECT_EQ(order.footprint(), sizeof(void*));
+
+    daking::emit(Filled{1, 2.0}, broadcast, order); // Nobody listens: no table, no allocation
+    EXPECT_EQ(order.footprint(), sizeof(void*));
+
+    daking::connect<Expired>(order, just() | then([]() {}));
+    EXPECT_GT(order.footprint(), sizeof(void*));
+}
+
+// 2. Connections behave as on a regular emitter
+TEST(CompactEmitterTest, ConnectEmitDisconnect) {
+    OrderState order;
+    double filled = 0;
+    std::vector<std::string> reasons;
+    int expired = 0;
+
+    auto con = daking::connect<Filled>(order, then([&](std::uint64_t, double qty) { filled += qty; }));
+    daking::connect<Rejected>(order, then([&](const std::string& reason) { reasons.push_back(reason); }));
+    daking::connect<Expired>(order, just() | then([&]() { expired++; }));
+
+    daking::emit(Filled{7, 1.5}, broadcast, order);
+    daking::emit(Rejected{std::string("price band")}, broadcast, order);
+    daking::emit(Expired{}, broadcast, order);
+
+    con.disable();
+    daking::emit(Filled{7, 1.5}, broadcast, order);
+    con.enable();
+    EXPECT_TRUE(daking::disconnect<Filled>(order, con));
+    EXPECT_FALSE(daking::disconnect<Filled>(order, con));
+    daking::emit(Filled{7, 1.5}, broadcast, order);
+
+    join_compact_emitters();
+    EXPECT_EQ(filled, 1.5);
+    EXPECT_EQ(reasons, std::vector<std::string>{"price band"});
+    EXPECT_EQ(expired, 1);
+}
+
+// 3. Moving an emitter keeps its connections; many instances live in a plain vector
+TEST(CompactEmitterTest, MoveAndContainers) {
+    std::vector<OrderState> orders(1000);
+    std::uint64_t fills = 0;
+
+    for (std::uint64_t i = 0; i < orders.size(); i += 10) {
+        orders[i].id_ = i;
+        daking::connect<Filled>(orders[i], then([&fills](std::uint64_t id, double) { fills += id; }));
+    }
+    orders.reserve(orders.capacity() * 2); // Relocates every instance
+
+    for (auto& order : orders) {
+        daking::emit(Filled{order.id_, 1.0}, broadcast, order);
+    }
+    join_compact_emitters();
+
+    EXPECT_EQ(fills, 49500u); // 0 + 10 + ... + 990
+}
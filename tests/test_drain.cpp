@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include <stdexec/execution.hpp>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "signal.hpp"
+
+using namespace daking;
+using namespace stdexec;
+using namespace std::chrono_literals;
+
+// --- Signal Definitions ---
+namespace {
+
+struct Recalc  : daking::signal<int> { using base::base; };
+struct Refresh : daking::signal<void> {};
+
+struct Model : enable_signal<Recalc, Refresh> {};
+
+// Work that holds its slot busy until released; the emitting thread is the one it runs on.
+struct held_work {
+    std::atomic<int>  running  = 0;
+    std::atomic<bool> released = false;
+
+    auto closure() {
+        return then([this](int) {
+            running++;
+            while (!released.load()) {
+                std::this_thread::sleep_for(1ms);
+            }
+            running--;
+        });
+    }
+
+    void wait_running(int n) const {
+        while (running.load() < n) {
+            std::this_thread::sleep_for(1ms);
+        }
+    }
+};
+
+}
+
+// 1. A drain waits for its slot only, not for the rest of the emitter
+TEST(SlotDrainTest, WaitsForOneSlot) {
+    Model model;
+    held_work first, second;
+    std::atomic<bool> drained = false;
+
+    auto con = daking::connect<Recalc>(model, first.closure());
+    std::thread a([&] { daking::emit(Recalc{1}, broadcast, model); });
+    first.wait_running(1);
+
+    auto other = daking::connect<Recalc>(model, second.closure());
+    con.disable();
+    std::thread b([&] { daking::emit(Recalc{2}, broadcast, model); });
+    second.wait_running(1);
+
+    std::thread waiting([&] { stdexec::sync_wait(daking::drain(con)); drained = true; });
+    std::this_thread::sleep_for(20ms);
+    EXPECT_FALSE(drained.load());
+
+    first.released = true;
+    waiting.join();
+    EXPECT_TRUE(drained.load());
+    EXPECT_EQ(second.running.load(), 1); // Still busy, and not waited for
+
+    second.released = true;
+    a.join();
+    b.join();
+}
+
+// 2. Hot reload: connect the replacement, disconnect the old slot, then await its last work
+TEST(SlotDrainTest, ReplaceAfterDisconnect) {
+    Model model;
+    held_work old_version;
+    std::atomic<int> new_version = 0;
+    std::atomic<bool> drained = false;
+
+    auto con = daking::connect<Recalc>(model, old_version.closure());
+    std::thread a([&] { daking::emit(Recalc{1}, broadcast, model); });
+    old_version.wait_running(1);
+
+    daking::connect<Recalc>(model, then([&](int) { new_version++; }));
+    EXPECT_TRUE(daking::disconnect<Recalc>(model, con));
+    daking::emit(Recalc{2}, broadcast, model);
+    EXPECT_EQ(new_version.load(), 1);
+
+    std::thread waiting([&] { stdexec::sync_wait(daking::drain(con)); drained = true; });
+    std::this_thread::sleep_for(20ms);
+    EXPECT_FALSE(drained.load()); // The running work keeps the disconnected slot reachable
+
+    old_version.released = true;
+    waiting.join();
+    a.join();
+    EXPECT_TRUE(drained.load());
+    stdexec::sync_wait(daking::drain(con)); // Nothing left: completes at once
+}
+
+// 3. Work spawned after the drain started is not waited for
+TEST(SlotDrainTest, LaterWorkNotAwaited) {
+    Model model;
+    std::atomic<int> phase = 0, running = 0;
+    std::atomic<bool> drained = false;
+
+    auto con = daking::connect<Recalc>(model, then([&](int wanted) {
+        running++;
+        while (phase.load() < wanted) {
+            std::this_thread::sleep_for(1ms);
+        }
+        running--;
+    }));
+    std::thread early([&] { daking::emit(Recalc{1}, broadcast, model); });
+    while (running.load() < 1) {
+        std::this_thread::sleep_for(1ms);
+    }
+
+    std::thread waiting([&] { stdexec::sync_wait(daking::drain(con)); drained = true; });
+    std::this_thread::sleep_for(20ms);
+    std::thread late([&] { daking::emit(Recalc{2}, broadcast, model); });
+    while (running.load() < 2) {
+        std::this_thread::sleep_for(1ms);
+    }
+
+    phase = 1; // Releases the early work only
+    waiting.join();
+    EXPECT_TRUE(drained.load());
+    EXPECT_EQ(running.load(), 1);
+
+    phase = 2;
+    early.join();
+    late.join();
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <stdexec/execution.hpp>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "signal.hpp"
+
+using namespace daking;
+using namespace stdexec;
+
+// --- Signal Definitions ---
+namespace {
+
+struct PluginLoaded : daking::signal<std::string, int> { using base::base; };
+struct Heartbeat    : daking::signal<void> {};
+
+template <int N>
+struct Probe : daking::signal<int> { using base::base; };
+
+struct PluginHost : event_bus {};
+
+}
+
+// 1. Units appear on first connect; publishing an unknown type is a no-op
+TEST(EventBusTest, LazyUnits) {
+    PluginHost bus;
+    int loaded = 0, beats = 0;
+
+    daking::publish(PluginLoaded{std::string("risk"), 1}, bus);
+    daking::publish(Heartbeat{}, bus);
+    EXPECT_EQ(bus.signal_types(), 0u);
+
+    auto con = daking::connect<PluginLoaded>(bus, then([&](const std::string& name, int version) {
+        EXPECT_EQ(name, "risk");
+        loaded += version;
+    }));
+    daking::connect<Heartbeat>(bus, just() | then([&]() { beats++; }));
+    daking::connect<Heartbeat>(bus, just() | then([&]() { beats++; }));
+    EXPECT_EQ(bus.signal_types(), 2u);
+
+    daking::publish(PluginLoaded{std::string("risk"), 2}, bus);
+    daking::publish(Heartbeat{}, bus);
+    EXPECT_EQ(loaded, 2);
+    EXPECT_EQ(beats, 2);
+
+    con.disable();
+    daking::publish(PluginLoaded{std::string("risk"), 3}, bus);
+    con.enable();
+    EXPECT_TRUE(daking::disconnect<PluginLoaded>(bus, con));
+    EXPECT_FALSE(daking::disconnect<PluginLoaded>(bus, con));
+    daking::publish(PluginLoaded{std::string("risk"), 4}, bus);
+    EXPECT_EQ(loaded, 2);
+    EXPECT_EQ(bus.signal_types(), 2u);
+}
+
+// 2. More types than the first table holds spill into linked tables and stay reachable
+TEST(EventBusTest, ManyTypes) {
+    PluginHost bus;
+    std::vector<int> seen(100, 0);
+
+    [&]<int...Ns>(std::integer_sequence<int, Ns...>) {
+        (daking::connect<Probe<Ns>>(bus, then([&](int v) { seen[Ns] += v; })), ...);
+        (daking::publish(Probe<Ns>{Ns + 1}, bus), ...);
+    }(std::make_integer_sequence<int, 100>());
+
+    EXPECT_EQ(bus.signal_types(), 100u);
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(seen[i], i + 1);
+    }
+}
+
+// 3. Threads racing to add the same types end up sharing one unit per type
+TEST(EventBusTest, ConcurrentDiscovery) {
+    PluginHost bus;
+    std::atomic<int> hits = 0;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&] {
+            [&]<int...Ns>(std::integer_sequence<int, Ns...>) {
+                (daking::connect<Probe<1000 + Ns>>(bus, then([&](int) { hits++; })), ...);
+            }(std::make_integer_sequence<int, 32>());
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(bus.signal_types(), 32u);
+
+    daking::publish(Probe<1000>{0}, bus);
+    daking::publish(Probe<1031>{0}, bus);
+    EXPECT_EQ(hits.load(), 8);
+}
+
+// 4. A node is taken for a type only if the type's name matches too, so a hash collision cannot
+// hand out another type's unit; names spelled out separately still match
+TEST(EventBusTest, CollidingHashes) {
+    detail::bus_node impostor(detail::type_hash<Heartbeat>, detail::type_name<PluginLoaded>());
+    EXPECT_FALSE(impostor.Holds<Heartbeat>());
+    EXPECT_FALSE(impostor.Holds<PluginLoaded>());
+
+    std::string spelled(detail::type_name<Heartbeat>());
+    detail::bus_node genuine(detail::type_hash<Heartbeat>, spelled);
+    EXPECT_TRUE(genuine.Holds<Heartbeat>());
+}
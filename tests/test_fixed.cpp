@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+#include <stdexec/execution.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "signal.hpp"
+
+using namespace daking;
+using namespace stdexec;
+
+// Counts the allocations each thread makes, so a test can assert a window on its own thread made none
+// whatever gtest or other threads allocate meanwhile.
+static thread_local std::size_t allocations = 0;
+
+void* operator new(std::size_t size) {
+    allocations++;
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+// --- Signal Definitions ---
+namespace {
+
+struct Reading : daking::signal<int> { using base::base; };
+struct Purge   : daking::signal<void> {};
+struct Label   : daking::signal<std::string> { using base::base; };
+
+struct Loop : fixed_emitter<4, Reading, Purge, Label> {};
+
+}
+
+// 1. The same connect / emit / disconnect surface as a regular emitter
+TEST(FixedEmitterTest, ConnectEmitDisconnect) {
+    Loop loop;
+    std::vector<int> readings;
+    int purges = 0;
+
+    auto con = daking::connect<Reading>(loop, then([&](int n) { readings.push_back(n); }));
+    daking::connect<Purge>(loop, just() | then([&]() { purges++; }));
+
+    daking::emit(Reading{1}, broadcast, loop);
+    daking::emit(Purge{}, broadcast, loop);
+
+    EXPECT_TRUE(con.disable());
+    daking::emit(Reading{2}, broadcast, loop);
+    EXPECT_TRUE(con.enable());
+    daking::emit(Reading{3}, broadcast, loop);
+
+    auto copy = con;
+    EXPECT_TRUE(daking::disconnect<Reading>(loop, copy));
+    EXPECT_FALSE(daking::disconnect<Reading>(loop, con));
+    EXPECT_FALSE(con.connected());
+    daking::emit(Reading{4}, broadcast, loop);
+
+    EXPECT_EQ(readings, (std::vector<int>{1, 3}));
+    EXPECT_EQ(purges, 1);
+}
+
+// 2. A full emitter refuses the connect; a freed slot is reused without reviving old handles
+TEST(FixedEmitterTest, CapacityExhausted) {
+    Loop loop;
+    int sum = 0;
+
+    std::vector<fixed_connection<Reading>> cons;
+    for (int i = 0; i < 4; i++) {
+        cons.push_back(daking::connect<Reading>(loop, then([&sum, i](int n) { sum += n * (i + 1); })));
+        EXPECT_TRUE(cons.back().connected());
+    }
+    auto refused = daking::connect<Reading>(loop, then([&](int) { sum = -1; }));
+    EXPECT_FALSE(refused.connected());
+    EXPECT_FALSE(refused.enable());
+    EXPECT_FALSE(daking::disconnect<Reading>(loop, refused));
+
+    daking::emit(Reading{1}, broadcast, loop);
+    EXPECT_EQ(sum, 1 + 2 + 3 + 4);
+
+    EXPECT_TRUE(daking::disconnect<Reading>(loop, cons[1]));
+    auto reused = daking::connect<Reading>(loop, then([&](int n) { sum += 100 * n; }));
+    EXPECT_TRUE(reused.connected());
+    EXPECT_FALSE(cons[1].connected());
+    EXPECT_FALSE(cons[1].disable()); // Stale: must not touch the slot's new occupant
+
+    sum = 0;
+    daking::emit(Reading{1}, broadcast, loop);
+    EXPECT_EQ(sum, 1 + 100 + 3 + 4);
+}
+
+// 3. Emitting, and rewiring, never allocates
+TEST(FixedEmitterTest, EmitDoesNotAllocate) {
+    Loop loop;
+    std::atomic<int> total = 0;
+    daking::connect<Reading>(loop, then([&](int n) { total += n; }));
+    daking::connect<Purge>(loop, just() | then([&]() { total++; }));
+
+    std::size_t before = allocations;
+    for (int i = 0; i < 1000; i++) {
+        daking::emit(Reading{i}, broadcast, loop);
+        daking::emit(Purge{}, broadcast, loop);
+    }
+    auto con = daking::connect<Reading>(loop, then([&](int) {}));
+    con.disable();
+    daking::disconnect<Reading>(loop, con);
+    EXPECT_EQ(allocations, before);
+    EXPECT_EQ(total.load(), 999 * 1000 / 2 + 1000);
+}
+
+// 4. A slot disconnecting itself mid-run is destroyed once it returns
+TEST(FixedEmitterTest, DisconnectFromOwnSlot) {
+    Loop loop;
+    int runs = 0;
+    fixed_connection<Reading> self;
+
+    self = daking::connect<Reading>(loop, then([&](int) {
+        runs++;
+        EXPECT_TRUE(daking::disconnect<Reading>(loop, self));
+    }));
+    daking::emit(Reading{1}, broadcast, loop);
+    daking::emit(Reading{2}, broadcast, loop);
+    EXPECT_EQ(runs, 1);
+    EXPECT_TRUE(daking::connect<Reading>(loop, then([](int) {})).connected());
+}
+
+// 5. Emits from several threads race connects and disconnects safely
+TEST(FixedEmitterTest, ConcurrentEmitAndRewire) {
+    Loop loop;
+    std::atomic<int> stable = 0;
+    std::atomic<bool> done = false;
+    daking::connect<Purge>(loop, just() | then([&]() { stable++; }));
+
+    std::vector<std::thread> emitters;
+    for (int t = 0; t < 2; t++) {
+        emitters.emplace_back([&] {
+            for (int i = 0; i < 5000; i++) {
+                daking::emit(Purge{}, broadcast, loop);
+            }
+        });
+    }
+    std::thread rewiring([&] {
+        std::atomic<int> churn = 0;
+        while (!done.load()) {
+            auto con = daking::connect<Purge>(loop, just() | then([&]() { churn++; }));
+            daking::disconnect<Purge>(loop, con);
+        }
+    });
+    for (auto& t : emitters) {
+        t.join();
+    }
+    done = true;
+    rewiring.join();
+    EXPECT_EQ(stable.load(), 10000);
+}
+
+// 6. Each slot gets its own copy of the arguments, which allocates only when copying them does
+TEST(FixedEmitterTest, ArgumentCopiesMayAllocate) {
+    Loop loop;
+    std::size_t length = 0;
+    daking::connect<Label>(loop, then([&](const std::string& label) { length += label.size(); }));
+    daking::connect<Label>(loop, then([&](const std::string& label) { length += label.size(); }));
+
+    Label small{std::string{}};
+    Label large{std::string(256, 'x')};
+
+    std::size_t before = allocations;
+    daking::emit(small, broadcast, loop);
+    EXPECT_EQ(allocations, before);
+
+    daking::emit(large, broadcast, loop);
+    EXPECT_EQ(allocations, before + 2); // One copy of the string per slot
+    EXPECT_EQ(length, 512u);
+}
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include <stdexec/execution.hpp>
+#include <atomic>
+#include <filesystem>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "signal_journal.hpp"
+
+#if defined(__linux__)
+
+using namespace daking;
+using namespace stdexec;
+
+// --- Signal Definitions ---
+namespace {
+
+struct Order  : daking::signal<std::uint64_t, std::string, double> { using base::base; };
+struct Cancel : daking::signal<std::uint64_t> {};
+struct Flush  : daking::signal<void> {};
+
+struct Gateway : enable_signal<Order, Cancel, Flush> {};
+
+}
+
+// Fresh log prefix in a per-test directory, removed afterwards.
+class JournalTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        dir_ = std::filesystem::temp_directory_path()
+            / ("daking_journal_" + std::to_string(::getpid()) + "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove_all(dir_);
+        std::filesystem::create_directories(dir_);
+        path_ = (dir_ / "gateway").string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(dir_);
+    }
+
+    std::size_t Segments() const {
+        return static_cast<std::size_t>(std::distance(std::filesystem::directory_iterator(dir_), std::filesystem::directory_iterator{}));
+    }
+
+    std::filesystem::path dir_;
+    std::string           path_;
+};
+
+// 1. Every signal type round-trips through the log in emission order
+TEST_F(JournalTest, RecordAndReplay) {
+    {
+        Gateway gateway;
+        journal<Order, Cancel, Flush> log(gateway, path_);
+        for (std::uint64_t i = 0; i < 100; i++) {
+            daking::emit(Order{i, "AAPL", 100.0 + i}, broadcast, gateway);
+            if (i % 10 == 9) {
+                daking::emit(Cancel{i}, broadcast, gateway);
+                daking::emit(Flush{}, broadcast, gateway);
+            }
+        }
+        EXPECT_EQ(log.recorded(), 120);
+        EXPECT_EQ(log.dropped(), 0);
+    }
+
+    Gateway replica;
+    std::vector<std::string> seen;
+    daking::connect<Order>(replica, then([&](std::uint64_t id, const std::string& symbol, double px) {
+        EXPECT_EQ(symbol, "AAPL");
+        EXPECT_EQ(px, 100.0 + id);
+        seen.push_back("o" + std::to_string(id));
+    }));
+    daking::connect<Cancel>(replica, then([&](std::uint64_t id) { seen.push_back("c" + std::to_string(id)); }));
+    daking::connect<Flush>(replica, just() | then([&]() { seen.push_back("f"); }));
+
+    journal_replayer<Order, Cancel, Flush> replayer(path_);
+    EXPECT_EQ(replayer.replay(replica), 120);
+    ASSERT_EQ(seen.size(), 120);
+    EXPECT_EQ(seen[0], "o0");
+    EXPECT_EQ(seen[9], "o9");
+    EXPECT_EQ(seen[10], "c9");
+    EXPECT_EQ(seen[11], "f");
+    EXPECT_EQ(seen.back(), "f");
+}
+
+// 2. Small segments rotate; concurrent emitters lose nothing and every sequence number appears once
+TEST_F(JournalTest, ConcurrentRotation) {
+    constexpr int THREADS = 4, PER_THREAD = 5000;
+    {
+        Gateway gateway;
+        journal<Order, Cancel, Flush> log(gateway, path_, 4096);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < THREADS; t++) {
+            threads.emplace_back([&, t] {
+                for (int i = 0; i < PER_THREAD; i++) {
+                    daking::emit(Order{std::uint64_t(t) * PER_THREAD + i, std::string(i % 7, 'x'), 1.0}, broadcast, gateway);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        EXPECT_EQ(log.recorded(), THREADS * PER_THREAD);
+    }
+    EXPECT_GT(Segments(), 10);
+
+    Gateway replica;
+    std::set<std::uint64_t> ids;
+    daking::connect<Order>(replica, then([&](std::uint64_t id, const std::string&, double) { ids.insert(id); }));
+    EXPECT_EQ((journal_replayer<Order, Cancel, Flush>(path_).replay(replica)), THREADS * PER_THREAD);
+    EXPECT_EQ(ids.size(), THREADS * PER_THREAD);
+}
+
+// 3. Original pacing reproduces the gaps between emissions: no record is replayed earlier after the first
+// than it was recorded, however loaded the machine
+TEST_F(JournalTest, OriginalPacing) {
+    using clock = std::chrono::steady_clock;
+    std::vector<clock::duration> earliest; // a lower bound of each record's recorded offset from the first
+    {
+        Gateway gateway;
+        journal<Order, Cancel, Flush> log(gateway, path_);
+        clock::time_point first;
+        for (std::uint64_t i = 0; i < 5; i++) {
+            auto before = clock::now();
+            daking::emit(Cancel{i}, broadcast, gateway);
+            if (i == 0) {
+                first = clock::now();
+            }
+            earliest.push_back(i == 0 ? clock::duration::zero() : before - first);
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+    }
+
+    Gateway replica;
+    std::vector<std::uint64_t>     ids;
+    std::vector<clock::time_point> seen;
+    daking::connect<Cancel>(replica, then([&](std::uint64_t id) {
+        ids.push_back(id);
+        seen.push_back(clock::now());
+    }));
+    journal_replayer<Order, Cancel, Flush> replayer(path_);
+
+    auto start = clock::now();
+    EXPECT_EQ(replayer.replay(replica, journal_pacing::original), 5);
+    ASSERT_EQ(ids, (std::vector<std::uint64_t>{0, 1, 2, 3, 4}));
+    for (std::size_t i = 1; i < seen.size(); i++) {
+        EXPECT_GE(seen[i] - start, earliest[i]);
+    }
+
+    ids.clear();
+    EXPECT_EQ(replayer.replay(replica), 5);
+    EXPECT_EQ(ids, (std::vector<std::uint64_t>{0, 1, 2, 3, 4}));
+}
+
+// 4. An existing log is never overwritten, and a log of other signals is rejected
+TEST_F(JournalTest, ExistingAndForeignLogs) {
+    Gateway gateway;
+    {
+        journal<Order, Cancel, Flush> log(gateway, path_);
+        daking::emit(Cancel{1}, broadcast, gateway);
+    }
+    EXPECT_THROW((journal<Order, Cancel, Flush>(gateway, path_)), std::system_error);
+    EXPECT_THROW((journal_replayer<Order, Cancel, Flush>(path_ + ".missing").replay(gateway)), std::runtime_error);
+    EXPECT_THROW((journal_replayer<Cancel, Order, Flush>(path_).replay(gateway)), std::runtime_error);
+
+    std::string huge(8192, 'x');
+    journal<Order, Cancel, Flush> small(gateway, path_ + ".small", 4096);
+    daking::emit(Order{1, huge, 1.0}, broadcast, gateway);
+    EXPECT_EQ(small.dropped(), 1);
+}
+
+#endif
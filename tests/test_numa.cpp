@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+#include <stdexec/execution.hpp>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <memory_resource>
+#include <thread>
+
+#include "signal.hpp"
+
+using namespace daking;
+using namespace stdexec;
+
+// --- Signal Definitions ---
+namespace {
+
+struct Order  : daking::signal<int> { using base::base; };
+struct Cancel : daking::signal<void> {};
+
+struct Matcher : enable_signal<Order, Cancel> {};
+
+// Spins until pred holds, for work handed to dispatch threads.
+template <typename Pred>
+bool eventually(Pred pred) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!pred()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+}
+
+// 1. Topologies: made up, and read from the machine
+TEST(NumaTest, Topology) {
+    auto simulated = numa_topology::simulated(2, 4);
+    EXPECT_EQ(simulated.nodes(), 2u);
+    EXPECT_EQ(simulated.cpus(1), (std::vector<int>{4, 5, 6, 7}));
+    EXPECT_EQ(simulated.node_of(5), 1);
+    EXPECT_EQ(simulated.node_of(8), -1);
+
+    auto machine = numa_topology::system();
+    ASSERT_GE(machine.nodes(), 1u);
+    for (std::size_t node = 0; node < machine.nodes(); node++) {
+        for (int cpu : machine.cpus(node)) {
+            EXPECT_EQ(machine.node_of(cpu), static_cast<int>(node));
+        }
+    }
+    EXPECT_THROW(numa_topology({}), std::runtime_error);
+}
+
+// 2. A connection records the node it was placed on, or its registering thread's
+TEST(NumaTest, PlacementRecordsNode) {
+    numa_domain domain(numa_topology::simulated(2, 1));
+    Matcher matcher;
+
+    auto pinned = daking::connect<Order>(matcher, numa_local(domain, 1), then([](int) {}));
+    EXPECT_EQ(pinned.node(), 1);
+
+    auto here = daking::connect<Order>(matcher, numa_local(domain), then([](int) {}));
+    EXPECT_EQ(here.node(), domain.this_node());
+
+    std::promise<int> registered;
+    domain.post(1, [&] {
+        registered.set_value(daking::connect<Order>(matcher, numa_local(domain), then([](int) {})).node());
+    });
+    EXPECT_EQ(registered.get_future().get(), 1);
+
+    auto plain = daking::connect<Order>(matcher, then([](int) {}));
+    EXPECT_EQ(plain.node(), -1);
+    EXPECT_THROW(numa_local(domain, 2), std::runtime_error);
+
+    daking::disconnect<Order>(matcher, pinned);
+    EXPECT_EQ(pinned.node(), -1);
+}
+
+// 3. Each partition runs on a dispatch thread of its node; the emitting thread's own partition runs in place.
+// The emissions come from a dispatch thread of node 0, whose node is fixed, where any other thread may migrate.
+TEST(NumaTest, PartitionsRunOnTheirNode) {
+    numa_domain domain(numa_topology::simulated(3, 1));
+    Matcher matcher;
+    int here = 0, away = 1;
+
+    std::atomic<int> seen_here = -2, seen_away = -2, seen_plain = -2;
+    std::atomic<int> runs = 0;
+    daking::connect<Order>(matcher, numa_local(domain, here), then([&](int n) { seen_here = domain.this_node(); runs += n; }));
+    daking::connect<Order>(matcher, numa_local(domain, away), then([&](int n) { seen_away = domain.this_node(); runs += n; }));
+    daking::connect<Order>(matcher, then([&](int n) { seen_plain = domain.this_node(); runs += n; }));
+    std::atomic<int> cancels = 0;
+    daking::connect<Cancel>(matcher, numa_local(domain, away), just() | then([&]() { cancels++; }));
+
+    domain.post(here, [&] {
+        daking::emit(Order{1}, broadcast, matcher);
+        daking::emit(Cancel{}, broadcast, matcher);
+    });
+    ASSERT_TRUE(eventually([&] { return runs.load() == 3 && cancels.load() == 1; }));
+    EXPECT_EQ(seen_here.load(), here);
+    EXPECT_EQ(seen_away.load(), away);
+    EXPECT_EQ(seen_plain.load(), here);
+}
+
+// 4. Disconnected and disabled placed slots are skipped, wherever they live
+TEST(NumaTest, DisconnectAndDisable) {
+    numa_domain domain(numa_topology::simulated(2, 1));
+    Matcher matcher;
+    int away = (domain.this_node() + 1) % 2;
+
+    std::atomic<int> total = 0, walks = 0;
+    auto adder = [&total](int weight) { return then([&total, weight](int n) { total += n * weight; }); };
+    auto one = daking::connect<Order>(matcher, numa_local(domain, away), adder(1));
+    auto ten = daking::connect<Order>(matcher, numa_local(domain, away), adder(10));
+    auto hundred = daking::connect<Order>(matcher, numa_local(domain), adder(100));
+    daking::connect<Order>(matcher, numa_local(domain, away), then([&walks](int) { walks++; }));
+
+    EXPECT_TRUE(daking::disconnect<Order>(matcher, one));
+    EXPECT_FALSE(daking::disconnect<Order>(matcher, one));
+    ten.disable();
+    daking::emit(Order{1}, broadcast, matcher);
+    ASSERT_TRUE(eventually([&] { return walks.load() == 1; })); // Flags are read when the partition is walked
+    ten.enable();
+    daking::emit(Order{2}, broadcast, matcher);
+    ASSERT_TRUE(eventually([&] { return walks.load() == 2; }));
+    stdexec::sync_wait(daking::drain(hundred));
+    EXPECT_EQ(total.load(), 100 + 220);
+    EXPECT_TRUE(daking::disconnect<Order>(matcher, hundred));
+}
+
+// 5. Slots placed on a node are allocated from the node's resource
+TEST(NumaTest, NodeResource) {
+    std::pmr::unsynchronized_pool_resource pools[2];
+    numa_domain domain(numa_topology::simulated(2, 1));
+    domain.set_resource(0, &pools[0]);
+    domain.set_resource(1, &pools[1]);
+
+    std::atomic<std::pmr::memory_resource*> seen = nullptr;
+    Matcher matcher;
+    daking::connect<Order>(matcher, numa_local(domain, 1), let_value([&seen](int) {
+        return read_env(get_allocator) | then([&seen](auto allocator) { seen = allocator.resource(); });
+    }));
+    daking::emit(Order{1}, broadcast, matcher);
+    ASSERT_TRUE(eventually([&] { return seen != nullptr; }));
+    EXPECT_EQ(seen.load(), &pools[1]);
+}
+
+// 6. Destroying an emitter waits for the partitions it queued on other nodes
+TEST(NumaTest, DestroyWithQueuedPartitions) {
+    numa_domain domain(numa_topology::simulated(2, 1));
+    int away = (domain.this_node() + 1) % 2;
+    std::atomic<int> runs = 0;
+    for (int round = 0; round < 50; round++) {
+        Matcher matcher;
+        daking::connect<Order>(matcher, numa_local(domain, away), then([&](int) { runs++; }));
+        for (int i = 0; i < 20; i++) {
+            daking::emit(Order{i}, broadcast, matcher);
+        }
+    }
+    EXPECT_EQ(runs.load(), 50 * 20);
+}
+
+// 7. Drain and close wait for walks still queued on another node
+TEST(NumaTest, DrainAndCloseWaitForQueuedWalks) {
+    numa_domain domain(numa_topology::simulated(2, 1));
+    Matcher matcher;
+    std::atomic<int> runs = 0;
+    auto con = daking::connect<Order>(matcher, numa_local(domain, 1), then([&](int) { runs++; }));
+
+    // Holds node 1's dispatch thread, then emits from node 0 so the walk queues behind it
+    auto queue_walk = [&](int n) {
+        auto release = std::make_shared<std::promise<void>>();
+        domain.post(1, [held = release->get_future().share()] { held.wait(); });
+        std::promise<void> emitted;
+        domain.post(0, [&] {
+            daking::emit(Order{n}, broadcast, matcher);
+            emitted.set_value();
+        });
+        emitted.get_future().wait();
+        return release;
+    };
+
+    auto release = queue_walk(1);
+    auto drained = std::async(std::launch::async, [&] { stdexec::sync_wait(daking::drain(con)); });
+    EXPECT_EQ(drained.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+    EXPECT_EQ(runs.load(), 0);
+    release->set_value();
+    drained.get();
+    EXPECT_EQ(runs.load(), 1);
+
+    release = queue_walk(2);
+    auto closed = std::async(std::launch::async, [&] { stdexec::sync_wait(daking::close(matcher)); });
+    EXPECT_EQ(closed.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+    release->set_value();
+    closed.get();
+    EXPECT_EQ(runs.load(), 2);
+}
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <stdexec/execution.hpp>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "signal.hpp"
+
+using namespace daking;
+using namespace stdexec;
+using namespace std::chrono_literals;
+
+// --- Signal Definitions ---
+namespace {
+
+struct Spot      : daking::signal<double> { using base::base; };
+struct Rebalance : daking::signal<void> {};
+
+struct Spread : daking::signal<int> {
+    using base::base;
+    static constexpr std::size_t ring_capacity = 8;
+};
+
+struct StrategyHost : enable_signal<Spot, Rebalance> {};
+struct SpreadSource : enable_signal<Spread> {};
+
+// One closure type, configured by its captures: what a live strategy change swaps in.
+static auto tagged(std::string tag, std::vector<std::string>& log) {
+    return then([tag, &log](double) { log.push_back(tag); });
+}
+
+static auto counted(int step, std::atomic<int>& total) {
+    return just() | then([step, &total]() { total += step; });
+}
+
+}
+
+// 1. The slot keeps its place in the list, its enabled state and its handle
+TEST(SlotReplaceTest, KeepsPositionStateAndHandle) {
+    StrategyHost host;
+    std::vector<std::string> log;
+
+    auto first  = daking::connect<Spot>(host, tagged("a", log));
+    auto second = daking::connect<Spot>(host, tagged("b", log));
+    daking::connect<Spot>(host, tagged("c", log));
+
+    EXPECT_TRUE(first.replace(tagged("A", log)));
+    daking::emit(Spot{1.0}, broadcast, host);
+    EXPECT_EQ(log, (std::vector<std::string>{"A", "b", "c"}));
+
+    log.clear();
+    second.disable();
+    EXPECT_TRUE(second.replace(tagged("B", log)));
+    daking::emit(Spot{1.0}, broadcast, host);
+    second.enable();
+    daking::emit(Spot{1.0}, broadcast, host);
+    EXPECT_EQ(log, (std::vector<std::string>{"A", "c", "A", "B", "c"}));
+
+    EXPECT_TRUE(first.replace(tagged("AA", log))); // Replacing again publishes a newer copy
+    EXPECT_TRUE(daking::disconnect<Spot>(host, second));
+    EXPECT_FALSE(second.replace(tagged("gone", log)));
+
+    log.clear();
+    daking::emit(Spot{1.0}, broadcast, host);
+    EXPECT_EQ(log, (std::vector<std::string>{"AA", "c"}));
+}
+
+// 2. Void slots replace their sender, ring consumers their closure
+TEST(SlotReplaceTest, VoidSlotsAndRingConsumers) {
+    StrategyHost host;
+    std::atomic<int> total = 0;
+
+    auto con = daking::connect<Rebalance>(host, counted(1, total));
+    daking::emit(Rebalance{}, broadcast, host);
+    con.replace(counted(100, total));
+    daking::emit(Rebalance{}, broadcast, host);
+    EXPECT_EQ(total.load(), 101);
+
+    std::atomic<int> spreads = 0;
+    {
+        SpreadSource source;
+        auto widen = [&spreads](int factor) { return then([factor, &spreads](int s) { spreads += s * factor; }); };
+        auto ring_con = daking::connect<Spread>(source, widen(1));
+        daking::emit(Spread{1}, broadcast, source);
+        while (spreads.load() != 1) {
+            std::this_thread::sleep_for(1ms);
+        }
+        EXPECT_TRUE(ring_con.replace(widen(10)));
+        daking::emit(Spread{1}, broadcast, source);
+    }
+    EXPECT_EQ(spreads.load(), 11);
+}
+
+// 3. Work running when the closure is replaced finishes on the old one; drain awaits it
+TEST(SlotReplaceTest, InFlightWorkKeepsOldClosure) {
+    StrategyHost host;
+    std::atomic<bool> running = false, released = false;
+    std::atomic<int> old_done = 0, new_done = 0;
+
+    auto version = [&](int v) {
+        return then([v, &running, &released, &old_done, &new_done](double) {
+            if (v == 1) {
+                running = true;
+                while (!released.load()) {
+                    std::this_thread::sleep_for(1ms);
+                }
+                old_done++;
+            }
+            else {
+                new_done++;
+            }
+        });
+    };
+
+    auto con = daking::connect<Spot>(host, version(1));
+    std::thread emitting([&] { daking::emit(Spot{1.0}, broadcast, host); });
+    while (!running.load()) {
+        std::this_thread::sleep_for(1ms);
+    }
+
+    con.replace(version(2));
+    daking::emit(Spot{2.0}, broadcast, host);
+    EXPECT_EQ(new_done.load(), 1);
+    EXPECT_EQ(old_done.load(), 0);
+
+    released = true;
+    stdexec::sync_wait(daking::drain(con));
+    EXPECT_EQ(old_done.load(), 1);
+    emitting.join();
+}
+
+// 4. Replacing while another thread emits never loses or tears an invocation
+TEST(SlotReplaceTest, ConcurrentReplaceAndEmit) {
+    StrategyHost host;
+    std::atomic<int> total = 0;
+
+    auto con = daking::connect<Rebalance>(host, counted(1, total));
+    std::thread emitting([&] {
+        for (int i = 0; i < 10000; i++) {
+            daking::emit(Rebalance{}, broadcast, host);
+        }
+    });
+    for (int i = 0; i < 100; i++) {
+        con.replace(counted(1, total));
+    }
+    emitting.join();
+    EXPECT_EQ(total.load(), 10000);
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <stdexec/execution.hpp>
+#include <atomic>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include "signal.hpp"
+
+using namespace daking;
+using namespace stdexec;
+
+// --- Signal Definitions ---
+namespace {
+
+struct Offer  : daking::signal<int> { using base::base; };
+struct Settle : daking::signal<void> {};
+
+struct Pricing : enable_signal<Offer, Settle> {
+    Pricing() = default;
+    explicit Pricing(std::pmr::memory_resource* resource) : enable_signal<Offer, Settle>(resource) {}
+};
+
+// Forwards to the global heap and counts what passes through, as a per-subsystem meter would.
+struct metered_resource : std::pmr::memory_resource {
+    std::atomic<std::size_t> allocations = 0;
+    std::atomic<std::size_t> in_use      = 0;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        allocations++;
+        in_use += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override {
+        in_use -= bytes;
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+}
+
+// 1. Slots and slot-list snapshots come from the emitter's resource and go back to it
+TEST(MemoryResourceTest, SlotsAndSnapshots) {
+    metered_resource meter;
+    {
+        Pricing pricing(&meter);
+        auto con = daking::connect<Offer>(pricing, then([](int) {}));
+        daking::connect<Settle>(pricing, just());
+        std::size_t after_connect = meter.allocations.load();
+        EXPECT_GE(after_connect, 4u); // Two slots, two snapshots
+
+        daking::emit(Offer{1}, broadcast, pricing);
+        EXPECT_EQ(meter.allocations.load(), after_connect);
+
+        daking::disconnect<Offer>(pricing, con);
+        EXPECT_GT(meter.allocations.load(), after_connect); // The shrunk snapshot
+    }
+    EXPECT_EQ(meter.in_use.load(), 0u);
+}
+
+// 2. Spawned work finds the resource through its environment's allocator
+TEST(MemoryResourceTest, SpawnedWorkSeesAllocator) {
+    metered_resource meter;
+    std::pmr::memory_resource* seen = nullptr;
+    auto probe = [&seen] {
+        return let_value([&seen](int) {
+            return read_env(get_allocator) | then([&seen](auto allocator) { seen = allocator.resource(); });
+        });
+    };
+
+    Pricing metered(&meter);
+    daking::connect<Offer>(metered, probe());
+    daking::emit(Offer{1}, broadcast, metered);
+    EXPECT_EQ(seen, &meter);
+
+    Pricing plain;
+    daking::connect<Offer>(plain, probe());
+    daking::emit(Offer{1}, broadcast, plain);
+    EXPECT_EQ(seen, std::pmr::get_default_resource());
+}
+
+// 3. A bounded arena backs a whole emitter, with no fallback to the heap
+TEST(MemoryResourceTest, MonotonicArena) {
+    alignas(std::max_align_t) static std::byte buffer[1 << 16];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+    std::atomic<int> total = 0;
+
+    Pricing pricing(&arena);
+    auto adder = [&total] { return then([&total](int n) { total += n; }); };
+
+    std::vector<decltype(daking::connect<Offer>(pricing, adder()))> cons;
+    for (int i = 0; i < 8; i++) {
+        cons.push_back(daking::connect<Offer>(pricing, adder()));
+    }
+    daking::disconnect<Offer>(pricing, cons.front());
+    daking::emit(Offer{2}, broadcast, pricing);
+    EXPECT_EQ(total.load(), 14);
+}
+
+// 4. Handles keep nothing on the resource, so they may outlive it
+TEST(MemoryResourceTest, HandlesOutliveResource) {
+    auto meter   = std::make_unique<metered_resource>();
+    auto pricing = std::make_unique<Pricing>(meter.get());
+    auto con     = daking::connect<Offer>(*pricing, then([](int) {}));
+
+    pricing.reset();
+    EXPECT_EQ(meter->in_use.load(), 0u);
+    meter.reset();
+    EXPECT_FALSE(con.enable());
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <stdexec/execution.hpp>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "signal.hpp"
+
+using namespace daking;
+using namespace stdexec;
+
+// --- Signal Definitions ---
+namespace {
+
+struct Request : daking::signal<int> { using base::base; };
+struct Closed  : daking::signal<void> {};
+
+struct Session : enable_signal<Request, Closed> {
+    explicit Session(scope_group& group) : enable_signal<Request, Closed>(group) {}
+};
+
+struct Stream : compact_emitter<Request> {
+    explicit Stream(scope_group& group) : compact_emitter<Request>(group) {}
+};
+
+}
+
+// 1. Short-lived emitters spawn into the group, and one close() awaits all of them
+TEST(ScopeGroupTest, ShortLivedMembers) {
+    scope_group group;
+    std::atomic<int> handled = 0, closed = 0;
+
+    for (int i = 0; i < 10000; i++) {
+        auto session = std::make_unique<Session>(group);
+        daking::connect<Request>(*session, then([&](int n) { handled += n; }));
+        daking::connect<Closed>(*session, just() | then([&]() { closed++; }));
+        daking::emit(Request{1}, broadcast, *session);
+        daking::emit(Closed{}, broadcast, *session);
+    }
+
+    stdexec::sync_wait(group.close());
+    EXPECT_EQ(handled.load(), 10000);
+    EXPECT_EQ(closed.load(), 10000);
+}
+
+// 2. Connection handles outlive their emitter without touching it
+TEST(ScopeGroupTest, ConnectionsOutliveMembers) {
+    scope_group group;
+    int handled = 0;
+
+    auto session = std::make_unique<Session>(group);
+    auto con = daking::connect<Request>(*session, then([&](int n) { handled += n; }));
+    daking::emit(Request{2}, con);
+    session.reset();
+
+    EXPECT_FALSE(con.enable());
+    stdexec::sync_wait(group.close());
+    EXPECT_EQ(handled, 2);
+}
+
+// 3. Compact emitters and event buses join groups too
+TEST(ScopeGroupTest, CompactAndBusMembers) {
+    scope_group group;
+    int handled = 0;
+
+    {
+        Stream stream(group);
+        EXPECT_GT(stream.footprint(), sizeof(void*)); // The table holding the group is allocated up front
+        daking::connect<Request>(stream, then([&](int n) { handled += n; }));
+        daking::emit(Request{3}, broadcast, stream);
+
+        event_bus bus(group);
+        daking::connect<Request>(bus, then([&](int n) { handled += n; }));
+        daking::publish(Request{4}, bus);
+    }
+
+    stdexec::sync_wait(group.close());
+    EXPECT_EQ(handled, 7);
+}
@@ -282,4 +282,51 @@ TEST_F(SenderTest, CaptureMultipleConnectionsCheck) {
     auto results = result.value();
     EXPECT_EQ(std::get<0>(results), 100);
     EXPECT_EQ(std::get<4>(results), 100);
-}
\ No newline at end of file
+}
+
+// 12. Capture through an indexed filter connection
+// Indexed connections live inside a composite slot, Check must still find them.
+TEST_F(SenderTest, CaptureIndexedConnection) {
+    int broadcast_count = 0;
+
+    auto con = daking::connect_if<TestSignal>(emitter, daking::arg_equals<0>(10), stdexec::then([](int i, std::string s) {
+        return s + "!";
+    }));
+    daking::connect_if<TestSignal>(emitter, daking::arg_equals<0>(10), stdexec::then([&](int i, std::string s) {
+        broadcast_count++;
+    }));
+
+    auto sender = daking::emit(TestSignal{10, "indexed"}, daking::capture, emitter, con);
+    auto [res] = *stdexec::sync_wait(std::move(sender));
+
+    EXPECT_EQ(res, "indexed!");
+    EXPECT_EQ(broadcast_count, 1);
+}
+
+// 13. Error Path: Capturing a consumer group member
+// The group would hand the broadcast copy to another member, so the capture is rejected before anything runs.
+TEST_F(SenderTest, CaptureGroupMemberError) {
+    int delivered = 0;
+
+    auto member = daking::connect<TestSignal>(emitter, daking::round_robin("workers"), stdexec::then([&](int i, std::string s) {
+        delivered++;
+        return i;
+    }));
+    daking::connect<TestSignal>(emitter, daking::round_robin("workers"), stdexec::then([&](int i, std::string s) {
+        delivered++;
+        return i;
+    }));
+
+    auto sender = daking::emit(TestSignal{1, "grouped"}, daking::capture, emitter, member);
+
+    try {
+        stdexec::sync_wait(std::move(sender));
+        FAIL() << "Should have thrown error for a group member";
+    } catch (const std::runtime_error& e) {
+        EXPECT_STREQ(e.what(), "Can't create sender: the connection is a member of consumer group 'workers'.");
+    }
+    EXPECT_EQ(delivered, 0);
+
+    auto [res] = *stdexec::sync_wait(TestSignal(7, "direct") >> daking::emit(member));
+    EXPECT_EQ(res, 7);
+}
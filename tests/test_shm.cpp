@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+#include <stdexec/execution.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "signal_shm.hpp"
+
+#if defined(__linux__)
+#include <csignal>
+#include <spawn.h>
+#include <sys/wait.h>
+
+extern char** environ;
+
+using namespace daking;
+using namespace stdexec;
+
+// --- Signal Definitions ---
+namespace {
+
+struct Fill : daking::signal<std::uint64_t, double, int> { using base::base; };
+struct Text : daking::signal<std::string> { using base::base; };
+
+static_assert(shm_transportable<Fill>);
+static_assert(!shm_transportable<Text>);
+
+static constexpr std::uint64_t CROSS_PROCESS_TOTAL = 100000;
+static constexpr const char*   CHILD_SEGMENT_ENV   = "DAKING_SHM_CHILD_SEGMENT";
+
+static std::string segment_name(const char* tag) {
+    return "/daking_test_" + std::string(tag) + "_" + std::to_string(::getpid());
+}
+
+}
+
+// 1. Same process: records round-trip through the ring, both directly and from a connected emitter
+TEST(ShmTransportTest, PublishAndForward) {
+    struct Desk : enable_signal<Fill> {} desk;
+    auto name = segment_name("local");
+    shm_publisher<Fill> out(name, 64);
+    std::atomic<std::uint64_t> last{0};
+    std::atomic<int> received{0};
+    {
+        shm_subscriber<Fill> in(name);
+        EXPECT_EQ(out.readers(), 1u);
+        daking::connect<Fill>(in, then([&](std::uint64_t id, double px, int qty) {
+            EXPECT_EQ(px, id * 0.5);
+            EXPECT_EQ(qty, static_cast<int>(id % 7));
+            last = id;
+            received++;
+        }));
+        daking::connect<Fill>(desk, out.forward());
+        in.start();
+
+        // Several laps of a 64-cell ring: the writer waits for the reader instead of overwriting it
+        for (std::uint64_t id = 1; id <= 500; ++id) {
+            out.publish(Fill{id, id * 0.5, static_cast<int>(id % 7)});
+        }
+        for (std::uint64_t id = 501; id <= 1000; ++id) {
+            emit(Fill{id, id * 0.5, static_cast<int>(id % 7)}, broadcast, desk);
+        }
+        while (received.load() < 1000) std::this_thread::yield();
+        EXPECT_EQ(in.dropped(), 0u);
+    }
+    EXPECT_EQ(out.readers(), 0u);
+    EXPECT_EQ(last.load(), 1000u);
+
+    EXPECT_THROW(shm_publisher<Fill>(name, 100), std::invalid_argument);
+    EXPECT_THROW(shm_subscriber<Fill>(segment_name("missing")), std::system_error);
+    try {
+        shm_publisher<Fill> twin(name, 64);
+        FAIL() << "A live segment must not be replaced";
+    } catch (const std::system_error& e) {
+        EXPECT_EQ(e.code(), std::errc::file_exists);
+    }
+}
+
+// Child side of CrossProcessDelivery; skipped unless spawned by it.
+TEST(ShmTransportTest, CrossProcessReader) {
+    const char* name = std::getenv(CHILD_SEGMENT_ENV);
+    if (!name) {
+        GTEST_SKIP() << "runs only as the child of CrossProcessDelivery";
+    }
+    std::atomic<std::uint64_t> expected{1};
+    std::atomic_bool in_order{true};
+    {
+        shm_subscriber<Fill> in(name);
+        daking::connect<Fill>(in, then([&](std::uint64_t id, double px, int qty) {
+            in_order = in_order && id == expected.load() && px == id * 0.25 && qty == static_cast<int>(id & 0xff);
+            expected = id + 1;
+        }));
+        in.start();
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while (expected.load() <= CROSS_PROCESS_TOTAL && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        EXPECT_EQ(in.dropped(), 0u);
+    }
+    EXPECT_EQ(expected.load(), CROSS_PROCESS_TOTAL + 1);
+    EXPECT_TRUE(in_order.load());
+}
+
+// 2. Two processes: a freshly exec'd child attaches to the parent's segment and checks order and content,
+// while the parent publishes many laps of a small ring at full speed
+TEST(ShmTransportTest, CrossProcessDelivery) {
+    auto name = segment_name("spawn");
+    shm_publisher<Fill> out(name, 256);
+
+    std::string filter = "--gtest_filter=ShmTransportTest.CrossProcessReader";
+    std::string env    = std::string(CHILD_SEGMENT_ENV) + "=" + name;
+    std::vector<char*> argv{const_cast<char*>("/proc/self/exe"), filter.data(), nullptr};
+    std::vector<char*> envp;
+    for (char** e = environ; *e; ++e) envp.push_back(*e);
+    envp.push_back(env.data());
+    envp.push_back(nullptr);
+
+    pid_t child = 0;
+    ASSERT_EQ(::posix_spawn(&child, "/proc/self/exe", nullptr, nullptr, argv.data(), envp.data()), 0);
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (out.readers() == 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(out.readers(), 1u);
+
+    for (std::uint64_t id = 1; id <= CROSS_PROCESS_TOTAL; ++id) {
+        out.publish(Fill{id, id * 0.25, static_cast<int>(id & 0xff)});
+    }
+
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+    EXPECT_EQ(out.readers(), 0u);
+}
+
+// 3. A writer process that dies holding a claimed sequence stalls the other writers only briefly:
+// the sequence is skipped, and the reader counts it as dropped
+TEST(ShmTransportTest, DeadWriterIsSkipped) {
+    auto name = segment_name("dead");
+    shm_publisher<Fill> out(name, 16);
+    std::atomic<std::uint64_t> last{0};
+    shm_subscriber<Fill> in(name);
+    daking::connect<Fill>(in, then([&](std::uint64_t id, double, int) { last = id; }));
+    in.start();
+
+    pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        for (std::uint64_t id = 1;; ++id) {
+            out.publish(Fill{id, 0.0, 0});
+        }
+    }
+
+    // Stop the forked writer until it is caught between claiming a sequence and publishing it
+    auto segment = detail::shm_segment::Open(name);
+    auto header  = static_cast<const detail::shm_header*>(segment.data());
+    bool caught  = false;
+    for (int attempt = 0; attempt < 10000 && !caught; attempt++) {
+        int status = 0;
+        ::kill(child, SIGSTOP);
+        ASSERT_EQ(::waitpid(child, &status, WUNTRACED), child);
+        caught = header->claim_.load() != header->cursor_.load();
+        if (!caught) {
+            ::kill(child, SIGCONT);
+            std::this_thread::yield();
+        }
+    }
+    ::kill(child, SIGKILL);
+    ::waitpid(child, nullptr, 0);
+    if (!caught) {
+        GTEST_SKIP() << "the writer was never stopped inside a write";
+    }
+
+    constexpr std::uint64_t final_id = std::uint64_t(1) << 40;
+    for (std::uint64_t id = final_id - 100; id <= final_id; ++id) {
+        out.publish(Fill{id, 0.0, 0});
+    }
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (last.load() != final_id && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(last.load(), final_id);
+    EXPECT_GE(in.dropped(), 1u);
+}
+
+#endif // __linux__
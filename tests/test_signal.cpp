@@ -139,4 +139,299 @@ TEST_F(SignalTest, MultiSlotCOW) {
     emitter.do_tick(10);
     EXPECT_EQ(a, 10); // Stayed same
     EXPECT_EQ(b, 20); // Increased
-}
\ No newline at end of file
+}
+
+// 7. Throttle Policy: at most one invocation per window, filtered before spawn
+TEST_F(SignalTest, ThrottlePolicy) {
+    using namespace std::chrono_literals;
+    BaseEmitter emitter;
+    std::atomic<int> count{0};
+
+    daking::connect<Tick>(emitter, daking::throttle(200ms), then([&](int) { count++; }));
+
+    for (int i = 0; i < 100; ++i) {
+        emitter.do_tick(i);
+    }
+    EXPECT_EQ(count.load(), 1); // Only the leading emission passes the window
+
+    std::this_thread::sleep_for(400ms);
+    emitter.do_tick(1);
+    EXPECT_EQ(count.load(), 2); // Window reopened by the timer wheel
+}
+
+// 8. Debounce Policy: one trailing invocation with the latest arguments
+TEST_F(SignalTest, DebouncePolicy) {
+    using namespace std::chrono_literals;
+    BaseEmitter emitter;
+    std::atomic<int> count{0};
+    std::atomic<int> last{-1};
+
+    daking::connect<Tick>(emitter, daking::debounce(50ms), then([&](int i) { count++; last = i; }));
+
+    for (int i = 0; i < 10; ++i) {
+        emitter.do_tick(i);
+    }
+    EXPECT_EQ(count.load(), 0); // Nothing is spawned while the stream is busy
+
+    std::this_thread::sleep_for(300ms);
+    EXPECT_EQ(count.load(), 1);
+    EXPECT_EQ(last.load(), 9);
+}
+
+// 9. Delayed Emission: fires once on the timer thread, handle reports completion
+TEST_F(SignalTest, EmitAfter) {
+    using namespace std::chrono_literals;
+    BaseEmitter emitter;
+    std::atomic<int> result{0};
+
+    daking::connect<Tick>(emitter, then([&](int i) { result = i; }));
+
+    daking::timer_handle handle = daking::emit_after(20ms, Tick{7}, daking::broadcast, emitter);
+    EXPECT_TRUE(handle.active());
+    EXPECT_EQ(result.load(), 0);
+
+    std::this_thread::sleep_for(200ms);
+    EXPECT_EQ(result.load(), 7);
+    EXPECT_FALSE(handle.active());
+    EXPECT_FALSE(handle.cancel()); // Already finished
+}
+
+// 10. Periodic Emission: repeats until cancelled; pending timers die with the emitter
+TEST_F(SignalTest, EmitEveryAndCancel) {
+    using namespace std::chrono_literals;
+    std::atomic<int> count{0};
+    {
+        BaseEmitter emitter;
+        daking::connect<Tick>(emitter, then([&](int) { count++; }));
+
+        auto handle = daking::emit_every(10ms, Tick{1}, daking::broadcast, emitter);
+        std::this_thread::sleep_for(200ms);
+        EXPECT_TRUE(handle.cancel());
+        EXPECT_FALSE(handle.active());
+
+        int stopped_at = count.load();
+        EXPECT_GE(stopped_at, 3);
+        std::this_thread::sleep_for(50ms);
+        EXPECT_EQ(count.load(), stopped_at);
+
+        // Left armed on purpose: the emitter destructor has to cancel it.
+        daking::emit_every(1ms, Tick{1}, daking::broadcast, emitter);
+        daking::emit_after(1h, Tick{1}, daking::broadcast, emitter);
+    }
+    int final_count = count.load();
+    std::this_thread::sleep_for(50ms);
+    EXPECT_EQ(count.load(), final_count);
+}
+
+// 11. Content Filter: predicate runs on the emitting thread before any spawn
+TEST_F(SignalTest, ConnectIfPredicate) {
+    BaseEmitter emitter;
+    int odd = 0;
+
+    daking::connect_if<Tick>(emitter, [](const int& i) { return i % 2 != 0; }, then([&](int) { odd++; }));
+
+    for (int i = 0; i < 10; ++i) {
+        emitter.do_tick(i);
+    }
+    EXPECT_EQ(odd, 5);
+}
+
+// 12. Indexed Equality Filter: arg_equals slots share one hash lookup per emission
+TEST_F(SignalTest, ConnectIfIndexed) {
+    BaseEmitter emitter;
+    int hits_99 = 0, hits_7 = 0;
+    std::string seen;
+
+    auto c99 = daking::connect_if<Tick>(emitter, daking::arg_equals<0>(99), then([&](int) { hits_99++; }));
+    daking::connect_if<Tick>(emitter, daking::arg_equals<0>(7), then([&](int) { hits_7++; }));
+    daking::connect_if<Msg>(emitter, daking::arg_equals<0>("alarm"), then([&](std::string s) { seen = s; }));
+
+    emitter.do_tick(99);
+    emitter.do_tick(7);
+    emitter.do_tick(1);
+    emitter.do_msg("noise");
+    emitter.do_msg("alarm");
+    EXPECT_EQ(hits_99, 1);
+    EXPECT_EQ(hits_7, 1);
+    EXPECT_EQ(seen, "alarm");
+
+    c99.disable();
+    emitter.do_tick(99);
+    EXPECT_EQ(hits_99, 1);
+
+    c99.enable();
+    EXPECT_TRUE(disconnect<Tick>(emitter, c99));
+    EXPECT_FALSE(disconnect<Tick>(emitter, c99));
+    emitter.do_tick(99);
+    emitter.do_tick(7);
+    EXPECT_EQ(hits_99, 1);
+    EXPECT_EQ(hits_7, 2);
+}
+
+// 13. Keyed Signal: emission visits only the slots registered under its key
+struct Quote : daking::keyed_signal<std::string, double> { using base::base; };
+struct QuoteFeed : enable_signal<Quote> {};
+
+TEST_F(SignalTest, KeyedSignalRouting) {
+    QuoteFeed feed;
+    std::vector<int> hits(100, 0);
+    int all = 0;
+
+    for (int i = 0; i < 100; ++i) { // Enough keys to grow the index several times
+        daking::connect<Quote>(feed, "SYM" + std::to_string(i), then([&hits, i](std::string, double) { hits[i]++; }));
+    }
+    auto extra = daking::connect<Quote>(feed, std::string("SYM42"), then([&](std::string, double) { hits[42] += 10; }));
+    daking::connect<Quote>(feed, then([&](std::string, double) { all++; })); // Unkeyed slot sees every key
+
+    emit(Quote{"SYM42", 1.5}, broadcast, feed);
+    emit(Quote{"SYM7", 2.5}, broadcast, feed);
+    emit(Quote{"NONE", 0.0}, broadcast, feed);
+
+    EXPECT_EQ(hits[42], 11);
+    EXPECT_EQ(hits[7], 1);
+    EXPECT_EQ(hits[0], 0);
+    EXPECT_EQ(all, 3);
+
+    EXPECT_TRUE(disconnect<Quote>(feed, extra));
+    emit(Quote{"SYM42", 1.5}, broadcast, feed);
+    EXPECT_EQ(hits[42], 12);
+}
+
+// 14. Partitioned Group: each emission reaches one member, the same key always the same member
+TEST_F(SignalTest, PartitionedConsumerGroup) {
+    BaseEmitter emitter;
+    std::vector<std::vector<int>> seen(4);
+    int observer = 0;
+
+    auto worker = [&seen](int m) { return then([&seen, m](int i) { seen[m].push_back(i); }); };
+    std::vector<decltype(daking::connect<Tick>(emitter, worker(0)))> members;
+    for (int m = 0; m < 4; ++m) {
+        members.push_back(daking::connect<Tick>(emitter, daking::partition_by<0>("workers"), worker(m)));
+    }
+    daking::connect<Tick>(emitter, then([&](int) { observer++; })); // Outside the group: sees everything
+
+    for (int round = 0; round < 2; ++round) {
+        for (int key = 0; key < 64; ++key) {
+            emitter.do_tick(key);
+        }
+    }
+
+    EXPECT_EQ(observer, 128);
+    std::vector<int> owner(64, -1);
+    std::size_t total = 0, busy = 0;
+    for (int m = 0; m < 4; ++m) {
+        total += seen[m].size();
+        busy  += !seen[m].empty();
+        for (int key : seen[m]) {
+            EXPECT_TRUE(owner[key] == -1 || owner[key] == m);
+            owner[key] = m;
+        }
+    }
+    EXPECT_EQ(total, 128u);
+    EXPECT_GT(busy, 1u);
+
+    // Leaving moves only the departed member's keys
+    int gone = owner[0];
+    EXPECT_TRUE(disconnect<Tick>(emitter, members[gone]));
+    for (auto& s : seen) s.clear();
+    for (int key = 0; key < 64; ++key) {
+        emitter.do_tick(key);
+    }
+    EXPECT_TRUE(seen[gone].empty());
+    for (int m = 0; m < 4; ++m) {
+        for (int key : seen[m]) {
+            if (owner[key] != gone) {
+                EXPECT_EQ(owner[key], m);
+            }
+        }
+    }
+}
+
+// 15. Keyless Groups: round-robin rotation and least-loaded selection skip disabled members
+TEST_F(SignalTest, RoundRobinAndLeastLoaded) {
+    BaseEmitter emitter;
+    int a = 0, b = 0, c = 0;
+
+    daking::connect<Tick>(emitter, daking::round_robin("rr"), then([&](int) { a++; }));
+    auto cb = daking::connect<Tick>(emitter, daking::round_robin("rr"), then([&](int) { b++; }));
+    daking::connect<Tick>(emitter, daking::round_robin("rr"), then([&](int) { c++; }));
+
+    for (int i = 0; i < 9; ++i) emitter.do_tick(i);
+    EXPECT_EQ(a, 3);
+    EXPECT_EQ(b, 3);
+    EXPECT_EQ(c, 3);
+
+    cb.disable();
+    for (int i = 0; i < 6; ++i) emitter.do_tick(i);
+    EXPECT_EQ(b, 3);
+    EXPECT_EQ(a + c, 12);
+
+    // The first emission reaches `busy`, which emits again while it is still in flight:
+    // every nested emission must bypass it for the idle member.
+    BaseEmitter ll_emitter;
+    int busy = 0, idle = 0;
+    daking::connect<Tick>(ll_emitter, daking::least_loaded("ll"), then([&](int i) {
+        busy++;
+        if (i == 0) {
+            for (int k = 1; k <= 5; ++k) ll_emitter.do_tick(k);
+        }
+    }));
+    daking::connect<Tick>(ll_emitter, daking::least_loaded("ll"), then([&](int) { idle++; }));
+
+    ll_emitter.do_tick(0);
+    EXPECT_EQ(busy, 1);
+    EXPECT_EQ(idle, 5);
+
+    // Once it completed, its load is released and it is eligible again
+    ll_emitter.do_tick(6);
+    EXPECT_EQ(busy, 2);
+
+    std::atomic<int> x{0}, y{0};
+    {
+        BaseEmitter pool_emitter;
+        daking::connect<Msg>(pool_emitter, daking::least_loaded("pool"), continues_on(sch_) | then([&](std::string) { x++; }));
+        daking::connect<Msg>(pool_emitter, daking::least_loaded("pool"), continues_on(sch_) | then([&](std::string) { y++; }));
+        for (int i = 0; i < 100; ++i) pool_emitter.do_msg("job");
+    }
+    EXPECT_EQ(x + y, 100);
+}
+
+// 16. Ring Signal: every consumer reads every emission in order through a small, wrapping ring
+struct Sample : daking::ring_signal<int, double> {
+    using base::base;
+    static constexpr std::size_t ring_capacity = 8;
+};
+struct SampleSource : enable_signal<Sample> {};
+
+TEST_F(SignalTest, RingSignalMulticast) {
+    std::vector<std::vector<int>> seen(3);
+    std::vector<int> late;
+    std::atomic<int> late_last{-1};
+    {
+        SampleSource source;
+        for (int c = 0; c < 3; ++c) {
+            daking::connect<Sample>(source, then([&seen, c](int i, double) { seen[c].push_back(i); }));
+        }
+        for (int i = 0; i < 500; ++i) {
+            emit(Sample{i, 0.5}, broadcast, source);
+        }
+
+        auto joined = daking::connect<Sample>(source, then([&](int i, double) { late.push_back(i); late_last = i; }));
+        for (int i = 500; i < 1000; ++i) {
+            emit(Sample{i, 0.5}, broadcast, source);
+        }
+        while (late_last.load() != 999) std::this_thread::yield();
+        EXPECT_TRUE(disconnect<Sample>(source, joined));
+        EXPECT_FALSE(disconnect<Sample>(source, joined));
+        emit(Sample{1000, 0.5}, broadcast, source);
+    } // Consumers drain the ring before the emitter goes away
+
+    for (auto& s : seen) {
+        ASSERT_EQ(s.size(), 1001u);
+        for (int i = 0; i <= 1000; ++i) EXPECT_EQ(s[i], i);
+    }
+    ASSERT_FALSE(late.empty());
+    EXPECT_GE(late.front(), 500); // Joined at the cursor, not at the start of the ring
+    EXPECT_EQ(late.back(), 999); // Disconnected before the last emission
+    for (std::size_t i = 1; i < late.size(); ++i) EXPECT_EQ(late[i], late[i - 1] + 1);
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <stdexec/execution.hpp>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "signal.hpp"
+
+using namespace daking;
+using namespace stdexec;
+
+namespace {
+
+// --- Signal Definitions ---
+struct Frame : daking::signal<int> { using base::base; };
+struct Idle  : daking::signal<void> {};
+struct Order : daking::signal<int, std::string> { using base::base; };
+
+struct Reactor : enable_signal<single_threaded, Frame, Idle, Order> {};
+
+static_assert(std::same_as<enable_signal<Frame, Idle>, detail::emitter_impl<multi_threaded, Frame, Idle>>);
+static_assert(std::derived_from<Reactor, detail::emitter_unit<Frame, single_threaded>>);
+static_assert(!std::derived_from<Reactor, detail::emitter_unit<Frame>>);
+
+template <typename... Args>
+concept enabling = requires { typename enable_signal<Args...>; };
+
+static_assert(enabling<single_threaded, Frame>);
+static_assert(!enabling<Frame, int>);
+static_assert(!enabling<Frame, single_threaded>);
+
+// 1. The same connect / emit / disconnect surface as a regular emitter
+TEST(SingleThreadedTest, ConnectEmitDisconnect) {
+    Reactor reactor;
+    std::vector<int> frames;
+    int idles = 0;
+
+    auto con = daking::connect<Frame>(reactor, then([&](int n) { frames.push_back(n); }));
+    daking::connect<Idle>(reactor, just() | then([&]() { idles++; }));
+
+    daking::emit(Frame{1}, broadcast, reactor);
+    Idle{} >> daking::emit(broadcast, reactor);
+
+    EXPECT_TRUE(con.disable());
+    daking::emit(Frame{2}, broadcast, reactor);
+    EXPECT_TRUE(con.enable());
+    daking::emit(Frame{3}, broadcast, reactor);
+
+    auto copy = con;
+    EXPECT_TRUE(daking::disconnect<Frame>(reactor, copy));
+    EXPECT_FALSE(daking::disconnect<Frame>(reactor, con));
+    EXPECT_FALSE(con.enable());
+    daking::emit(Frame{4}, broadcast, reactor);
+
+    EXPECT_EQ(frames, (std::vector<int>{1, 3}));
+    EXPECT_EQ(idles, 1);
+}
+
+// 2. Closures running inline may rewire the emitter in the middle of a broadcast
+TEST(SingleThreadedTest, RewireDuringBroadcast) {
+    Reactor reactor;
+    std::vector<int> seen;
+    std::function<void()> unhook;
+
+    auto con = daking::connect<Frame>(reactor, then([&](int n) {
+        seen.push_back(n);
+        unhook();
+        daking::connect<Frame>(reactor, then([&](int n) { seen.push_back(100 + n); }));
+    }));
+    unhook = [&] { daking::disconnect<Frame>(reactor, con); };
+    daking::connect<Frame>(reactor, then([&](int n) { seen.push_back(10 + n); }));
+
+    daking::emit(Frame{1}, broadcast, reactor); // The slot added now waits for the next emission
+    daking::emit(Frame{2}, broadcast, reactor);
+
+    EXPECT_EQ(seen, (std::vector<int>{1, 11, 12, 102}));
+}
+
+// 3. Handles outlive their emitter and report it
+TEST(SingleThreadedTest, HandlesOutliveEmitter) {
+    auto reactor = std::make_unique<Reactor>();
+    auto con = daking::connect<Idle>(*reactor, just());
+    EXPECT_TRUE(con.enable());
+    reactor.reset();
+    EXPECT_FALSE(con.enable());
+    EXPECT_FALSE(con.disable());
+}
+
+// 4. Filters, key indices and consumer groups run on the same units
+TEST(SingleThreadedTest, PoliciesKeysAndGroups) {
+    Reactor reactor;
+    std::vector<std::string> seen;
+
+    daking::connect_if<Order>(reactor, [](const int& qty, const std::string&) { return qty >= 10; },
+        then([&](int, std::string id) { seen.push_back("big:" + id); }));
+    auto keyed = daking::connect_if<Order>(reactor, daking::arg_equals<0>(7),
+        then([&](int, std::string id) { seen.push_back("seven:" + id); }));
+    daking::connect<Order>(reactor, daking::round_robin("desks"), then([&](int, std::string id) { seen.push_back("a:" + id); }));
+    daking::connect<Order>(reactor, daking::round_robin("desks"), then([&](int, std::string id) { seen.push_back("b:" + id); }));
+
+    daking::emit(Order{7, "x"}, broadcast, reactor);
+    daking::emit(Order{12, "y"}, broadcast, reactor);
+    EXPECT_TRUE(daking::disconnect<Order>(reactor, keyed));
+    daking::emit(Order{7, "z"}, broadcast, reactor);
+
+    std::sort(seen.begin(), seen.end());
+    EXPECT_EQ(seen, (std::vector<std::string>{"a:x", "a:z", "b:y", "big:y", "seven:x"}));
+}
+
+// 5. Replace swaps the closure in place, drain and close complete once the work is done
+TEST(SingleThreadedTest, ReplaceDrainClose) {
+    Reactor reactor;
+    std::vector<int> seen;
+
+    auto scaled = [&](int factor) { return then([&seen, factor](int n) { seen.push_back(n * factor); }); };
+    auto con = daking::connect<Frame>(reactor, scaled(1));
+
+    daking::emit(Frame{1}, broadcast, reactor);
+    EXPECT_TRUE(con.replace(scaled(10)));
+    daking::emit(Frame{2}, broadcast, reactor);
+    stdexec::sync_wait(daking::drain(con));
+
+    stdexec::sync_wait(daking::close(reactor));
+    daking::emit(Frame{3}, broadcast, reactor);
+    EXPECT_FALSE(con.enable()); // A closed emitter's slots are gone
+    EXPECT_FALSE(con.replace(scaled(100)));
+    EXPECT_THROW(daking::connect<Frame>(reactor, scaled(1)), std::runtime_error);
+
+    EXPECT_EQ(seen, (std::vector<int>{1, 20}));
+}
+
+#ifndef NDEBUG
+// 6. Debug builds catch a second thread
+TEST(SingleThreadedDeathTest, SecondThreadAsserts) {
+    EXPECT_DEATH({
+        Reactor reactor;
+        daking::emit(Frame{1}, broadcast, reactor);
+        std::thread([&] { daking::emit(Frame{2}, broadcast, reactor); }).join();
+    }, "second thread");
+}
+#endif
+
+}
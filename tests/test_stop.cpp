@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <stdexec/execution.hpp>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "signal.hpp"
+
+using namespace daking;
+using namespace stdexec;
+using namespace std::chrono_literals;
+
+// --- Signal Definitions ---
+namespace {
+
+struct Reprice    : daking::signal<double> { using base::base; };
+struct Invalidate : daking::signal<void> {};
+
+struct Quoter : enable_signal<Reprice, Invalidate> {};
+
+// A long computation that polls the stop token of the slot it runs in.
+static auto cooperative(std::atomic<bool>& started, std::atomic<bool>& aborted) {
+    return let_value([&](double) {
+        return read_env(get_stop_token) | then([&](inplace_stop_token token) {
+            started = true;
+            auto deadline = std::chrono::steady_clock::now() + 5s;
+            while (!token.stop_requested() && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::sleep_for(1ms);
+            }
+            aborted = token.stop_requested();
+        });
+    });
+}
+
+}
+
+// 1. Disconnecting a slot stops the work it already spawned
+TEST(SlotStopTest, DisconnectStopsRunningWork) {
+    Quoter quoter;
+    std::atomic<bool> started = false, aborted = false;
+
+    auto con = daking::connect<Reprice>(quoter, cooperative(started, aborted));
+    std::thread emitting([&] { daking::emit(Reprice{1.0}, broadcast, quoter); });
+    while (!started.load()) {
+        std::this_thread::sleep_for(1ms);
+    }
+
+    EXPECT_TRUE(daking::disconnect<Reprice>(quoter, con));
+    emitting.join();
+    EXPECT_TRUE(aborted.load());
+}
+
+// 2. Closing the emitter stops every slot's running work
+TEST(SlotStopTest, CloseStopsRunningWork) {
+    Quoter quoter;
+    std::atomic<bool> started = false, aborted = false;
+
+    daking::connect<Reprice>(quoter, cooperative(started, aborted));
+    std::thread emitting([&] { daking::emit(Reprice{1.0}, broadcast, quoter); });
+    while (!started.load()) {
+        std::this_thread::sleep_for(1ms);
+    }
+
+    stdexec::sync_wait(daking::close(quoter));
+    emitting.join();
+    EXPECT_TRUE(aborted.load());
+}
+
+// 3. Each slot has its own token; disabling leaves it untouched
+TEST(SlotStopTest, TokensArePerSlot) {
+    Quoter quoter;
+    bool first_stopped = true, second_stopped = true, possible = false;
+
+    auto first = daking::connect<Invalidate>(quoter, read_env(get_stop_token) | then([&](inplace_stop_token token) {
+        first_stopped = token.stop_requested();
+    }));
+    auto second = daking::connect<Invalidate>(quoter, read_env(get_stop_token) | then([&](inplace_stop_token token) {
+        second_stopped = token.stop_requested();
+        possible = token.stop_possible();
+    }));
+
+    first.disable();
+    first.enable();
+    daking::emit(Invalidate{}, broadcast, quoter);
+    EXPECT_FALSE(first_stopped);
+
+    second_stopped = true;
+    daking::disconnect<Invalidate>(quoter, first);
+    daking::emit(Invalidate{}, broadcast, quoter);
+    EXPECT_FALSE(second_stopped);
+    EXPECT_TRUE(possible);
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include <stdexec/execution.hpp>
+#include <string>
+#include <vector>
+
+#include "signal.hpp"
+
+using namespace daking;
+using namespace stdexec;
+
+// --- Signal Definitions ---
+namespace {
+
+struct Telemetry : daking::signal<double, double> { using base::base; };
+struct Alarm     : daking::signal<void> {};
+
+struct FactoryBus : topic_bus<Telemetry, Alarm> {};
+
+}
+
+// 1. Exact, single-segment and multi-segment patterns
+TEST(TopicBusTest, WildcardRouting) {
+    FactoryBus bus;
+    int exact = 0, line3 = 0, factory = 0, other = 0;
+
+    daking::subscribe<Telemetry>(bus, "factory.line3.telemetry", then([&](double, double) { exact++; }));
+    daking::subscribe<Telemetry>(bus, "factory.line3.*", then([&](double, double) { line3++; }));
+    daking::subscribe<Telemetry>(bus, "factory.#", then([&](double, double) { factory++; }));
+    daking::subscribe<Telemetry>(bus, "warehouse.*", then([&](double, double) { other++; }));
+
+    daking::publish(Telemetry{45.5, 800.0}, "factory.line3.telemetry", bus);
+    daking::publish(Telemetry{45.5, 800.0}, "factory.line3.power", bus);
+    daking::publish(Telemetry{45.5, 800.0}, "factory.line1.cell2.telemetry", bus);
+    daking::publish(Telemetry{45.5, 800.0}, "factory", bus); // '#' also matches zero segments
+
+    EXPECT_EQ(exact, 1);
+    EXPECT_EQ(line3, 2);
+    EXPECT_EQ(factory, 4);
+    EXPECT_EQ(other, 0);
+}
+
+// 2. Cached resolutions are invalidated by subscription changes
+TEST(TopicBusTest, CacheInvalidation) {
+    FactoryBus bus;
+    int first = 0, late = 0;
+
+    auto con = daking::subscribe<Telemetry>(bus, "factory.*.telemetry", then([&](double, double) { first++; }));
+
+    daking::publish(Telemetry{1.0, 1.0}, "factory.line3.telemetry", bus); // Resolves and caches the topic
+    daking::subscribe<Telemetry>(bus, "factory.line3.#", then([&](double, double) { late++; }));
+    daking::publish(Telemetry{1.0, 1.0}, "factory.line3.telemetry", bus);
+
+    EXPECT_EQ(first, 2);
+    EXPECT_EQ(late, 1);
+
+    EXPECT_TRUE(daking::unsubscribe<Telemetry>(bus, con));
+    EXPECT_FALSE(daking::unsubscribe<Telemetry>(bus, con));
+    daking::publish(Telemetry{1.0, 1.0}, "factory.line3.telemetry", bus);
+
+    EXPECT_EQ(first, 2);
+    EXPECT_EQ(late, 2);
+}
+
+// 3. Connection semantics carry over: gating and void signals
+TEST(TopicBusTest, ConnectionGating) {
+    FactoryBus bus;
+    int alarms = 0;
+
+    auto con = daking::subscribe<Alarm>(bus, "factory.*.alarm", just() | then([&]() { alarms++; }));
+
+    daking::publish(Alarm{}, "factory.line3.alarm", bus);
+    con.disable();
+    daking::publish(Alarm{}, "factory.line3.alarm", bus);
+    con.enable();
+    daking::publish(Alarm{}, "factory.line4.alarm", bus);
+
+    EXPECT_EQ(alarms, 2);
+    EXPECT_THROW(daking::subscribe<Alarm>(bus, "factory..alarm", just()), std::invalid_argument);
+}
+
+// 4. Many distinct topics overflow the bounded cache, and pattern churn leaves routing intact
+TEST(TopicBusTest, CacheEvictionAndChurn) {
+    FactoryBus bus;
+    int all = 0, churned = 0;
+
+    daking::subscribe<Telemetry>(bus, "sensor.#", then([&](double, double) { all++; }));
+
+    for (int round = 0; round < 2; round++) {
+        for (int i = 0; i < 8192; i++) {
+            daking::publish(Telemetry{1.0, 1.0}, "sensor." + std::to_string(i), bus);
+        }
+    }
+    EXPECT_EQ(all, 2 * 8192);
+
+    for (int i = 0; i < 100; i++) {
+        auto con = daking::subscribe<Telemetry>(bus, "sensor.churn." + std::to_string(i) + ".*", then([&](double, double) { churned++; }));
+        daking::publish(Telemetry{1.0, 1.0}, "sensor.churn." + std::to_string(i) + ".value", bus);
+        EXPECT_TRUE(daking::unsubscribe<Telemetry>(bus, con));
+        daking::publish(Telemetry{1.0, 1.0}, "sensor.churn." + std::to_string(i) + ".value", bus);
+    }
+    EXPECT_EQ(churned, 100);
+    EXPECT_EQ(all, 2 * 8192 + 200);
+}